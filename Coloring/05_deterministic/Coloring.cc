@@ -0,0 +1,61 @@
+#include "Coloring.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+// 输出格式: 颜色数,c0,c1,...  (每个点的颜色)
+template <typename T>
+void print_coloring(parlay::sequence<T>& colors, std::string algo, std::string graphname) {
+    std::ofstream out("Coloring/" + algo + "/output/" + graphname + ".txt");
+    T num_colors = 0; for (size_t i = 0; i < colors.size(); i++) num_colors = std::max(num_colors, colors[i] + 1); out << num_colors;
+    for (size_t i = 0; i < colors.size(); i++) { out << "," << colors[i]; }
+    out.close();
+}
+
+
+namespace gbbs {
+
+template <class Graph>
+double Coloring_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: Coloring" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    std::string pri = P.getOptionValue("-priority", "perm");
+    uint64_t seed = P.getOptionLongValue("-seed", 0);
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+    std::cout << "### Params: -priority = " << pri << std::endl;
+    std::cout << "### Params: -seed = " << seed << std::endl;
+
+    double tt = 0.0; timer t; t.start();
+    auto colors =
+        (pri == "hash")   ? Coloring_rootset::Coloring<priority::hashed>(G, seed) :
+        (pri == "degree") ? Coloring_rootset::Coloring<priority::degree>(G, seed) :
+        (pri == "kcore")  ? Coloring_rootset::Coloring<priority::kcore>(G, seed) :
+                            Coloring_rootset::Coloring<priority::permutation>(G, seed);
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "05_deterministic", G.n, G.m, size_t(num_workers()), seed});
+
+    if (P.getOption("-verify")) {
+        std::cout << "## Verify: " << (Coloring_rootset::check_coloring(G, colors) ? "OK" : "FAILED") << std::endl;
+        print_coloring(colors, "05_deterministic", get_graphname(P.getArgument(0)));
+    }
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::Coloring_runner, false);
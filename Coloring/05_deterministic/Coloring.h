@@ -0,0 +1,112 @@
+#pragma once
+#include <vector>
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "priority.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace Coloring_rootset {
+
+// Jones–Plassmann: 计数器 = 优先级更高且还没着色的邻居数，和 MIS 一样。
+// 计数器为 0 的点 (root) 的更早邻居都已经着色，取它们没用过的最小颜色；
+// 然后给更晚的邻居减一，减到 0 的成为新的 roots。
+
+template <class W, class Pri>
+struct color_f {
+    Counter* counters;
+    const Pri* pri;
+    color_f(Counter* _counters, const Pri* _pri) : counters(_counters), pri(_pri) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (pri->before(s, d)) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (pri->before(s, d)) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+};
+
+// v 的更早邻居没有用过的最小颜色。颜色不超过更早邻居的个数，
+// 所以位图只要 deg + 1 位; 度数小于 64 时只用一个字
+// 更晚的邻居可能在同一轮里写自己的颜色，所以先判断 pri.before 再读，读用原子 load
+template <class Graph, class Pri>
+inline uintE first_fit(Graph& G, uintE v, const sequence<uintE>& colors, const Pri& pri) {
+    using W = typename Graph::weight_type;
+    auto nghs = G.get_vertex(v).out_neighbors();
+    size_t d = nghs.get_degree();
+    if (d < 64) {
+        uint64_t used = 0;
+        nghs.map([&](uintE src, uintE u, const W& wgh) {
+            if (!pri.before(u, v)) return;
+            uintE c = __atomic_load_n(&colors[u], __ATOMIC_RELAXED);
+            if (c < 64) used |= 1ull << c;
+        }, false);
+        return __builtin_ctzll(~used);
+    }
+    std::vector<uint64_t> used(d / 64 + 1, 0);
+    nghs.map([&](uintE src, uintE u, const W& wgh) {
+        if (!pri.before(u, v)) return;
+        uintE c = __atomic_load_n(&colors[u], __ATOMIC_RELAXED);
+        if (c <= d) used[c / 64] |= 1ull << (c % 64);
+    }, false);
+    size_t w = 0;
+    while (~used[w] == 0) w++;
+    return w * 64 + __builtin_ctzll(~used[w]);
+}
+
+template <class Pri, class Graph>
+inline sequence<uintE> Coloring(Graph& G, uint64_t seed) {
+    using W = typename Graph::weight_type;
+
+    // 初始化优先级和计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    const Pri pri = Pri::build(G, seed);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return pri.before(ngh, src);};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    auto colors = sequence<uintE>(n, UINT_E_MAX);
+    size_t rounds = 0, finished = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { __atomic_store_n(&colors[v], first_fit(G, v, colors, pri), __ATOMIC_RELAXED); }); // roots着色
+        auto new_roots = edgeMap(G, roots, color_f<W, Pri>(counters.begin(), &pri), -1, sparse_blocked); // 更晚的邻居减一，减到 0 的成为新的 roots
+        rounds++; finished += roots.size();
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), 0, telemetry::edges(G, roots), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    std::cout << "## rounds = " << rounds << std::endl;
+    std::cout << "## Colors used = " << parlay::reduce(colors, parlay::maxm<uintE>()) + 1 << std::endl;
+    return colors;
+}
+
+// 每个点都着了色，且相邻的点颜色不同
+template <class Graph>
+inline bool check_coloring(Graph& G, const sequence<uintE>& colors) {
+    using W = typename Graph::weight_type;
+    auto bad = parlay::delayed_seq<bool>(G.n, [&](size_t v) {
+        if (colors[v] == UINT_E_MAX) return true;
+        auto same_f = [&](uintE src, uintE ngh, const W& wgh) { return colors[ngh] == colors[src]; };
+        return G.get_vertex(v).out_neighbors().count(same_f) > 0;
+    });
+    return parlay::count(bad, true) == 0;
+}
+
+
+}  // namespace Coloring_rootset
+}  // namespace gbbs
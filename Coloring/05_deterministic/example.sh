@@ -0,0 +1,5 @@
+cd ../..
+bazel build //Coloring/05_deterministic:Coloring_main -c opt
+# bazel-bin/Coloring/05_deterministic/Coloring_main -s -b -verify -priority degree utils/small_graph.bin
+bazel-bin/Coloring/05_deterministic/Coloring_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd Coloring/05_deterministic
\ No newline at end of file
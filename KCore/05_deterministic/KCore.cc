@@ -0,0 +1,74 @@
+// 计数器由 BUILD 里的 copts 选择，默认是 deterministic_counter.h
+#if defined(KCORE_PERTHREAD_COUNTER)
+#include "perthread_counter.h"
+using KCoreCounter = Counter;
+#define KCORE_COUNTER_NAME "perthread"
+#elif defined(KCORE_DOUBLE_COUNTER)
+#include "double_counter.h"
+using KCoreCounter = Counter;
+#define KCORE_COUNTER_NAME "double"
+#elif defined(KCORE_CONCURRENT_COUNTER)
+#include "concurrent_counter.h"
+using KCoreCounter = ParCounter;
+#define KCORE_COUNTER_NAME "concurrent"
+#else
+#include "deterministic_counter.h"
+using KCoreCounter = Counter;
+#define KCORE_COUNTER_NAME "deterministic"
+#endif
+#include "KCore.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+// 输出格式: 最大 coreness,c0,c1,...  (每个点的 coreness)
+template <typename T>
+void print_coreness(parlay::sequence<T>& coreness, std::string algo, std::string graphname) {
+    std::ofstream out("KCore/" + algo + "/output/" + graphname + ".txt");
+    T max_core = 0; for (size_t i = 0; i < coreness.size(); i++) max_core = std::max(max_core, coreness[i]); out << max_core;
+    for (size_t i = 0; i < coreness.size(); i++) { out << "," << coreness[i]; }
+    out.close();
+}
+
+
+namespace gbbs {
+
+template <class Graph>
+double KCore_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: KCore" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+    std::cout << "### Counter: " << KCORE_COUNTER_NAME << std::endl;
+
+    double tt = 0.0; timer t; t.start();
+    auto coreness = KCore_rootset::KCore<KCoreCounter>(G);
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), std::string("05_deterministic/") + KCORE_COUNTER_NAME, G.n, G.m, size_t(num_workers()), 0});
+
+    if (P.getOption("-verify")) {
+        auto expected = KCore_rootset::sequential_coreness(G);
+        size_t diff = parlay::count(parlay::delayed_seq<bool>(G.n, [&](size_t v) { return expected[v] != coreness[v]; }), true);
+        std::cout << "## Verify: " << (diff == 0 ? "OK" : "FAILED") << " (" << diff << " vertices differ from the sequential peeling)" << std::endl;
+        print_coreness(coreness, "05_deterministic", get_graphname(P.getArgument(0)));
+    }
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::KCore_runner, false);
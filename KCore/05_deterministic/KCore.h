@@ -0,0 +1,173 @@
+#pragma once
+#include <vector>
+#include "gbbs/gbbs.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace KCore_rootset {
+
+// k-core 剥离: 计数器 = 还没剥掉的邻居数 (初始为度数)。
+// 当前层 k 的 frontier 里的点 coreness = k，剥掉后给没剥掉的邻居减一 (decrement_until(k))。
+// 并发时两个调用可能都读到 k + 1 再一起减，计数器会减到 k 以下，但从 k + 1 到 k 的那一次减一只有一个调用返回 true，
+// 返回 true 的点记在 crossed 里。每轮 edgeMap 输出被减过的邻居 (stamp 去重)，其中 crossed 的进入同一层的下一轮 frontier，
+// 其余的 (计数器仍大于 k) 按新的计数器值重新放进桶里。frontier 空了就进入下一层: 取最小的非空桶。
+// 计数器类型 C 由 KCore.cc 选 (见 BUILD)，需要 C(int)、decrement_until(k)、decrement_until_atomic(k) 和 get()。
+template <class W, class C>
+struct peel_f {
+    C* counters;
+    bool* peeled;
+    bool* crossed;                // 计数器从 k + 1 减到 k 的点
+    uintE* stamp;                 // 最近一次被减的轮号，用来让每个邻居每轮只输出一次
+    int k;
+    uintE round;
+    peel_f(C* _counters, bool* _peeled, bool* _crossed, uintE* _stamp, int _k, uintE _round)
+        : counters(_counters), peeled(_peeled), crossed(_crossed), stamp(_stamp), k(_k), round(_round) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (counters[d].decrement_until_atomic(k)) crossed[d] = true;
+        uintE old = __atomic_load_n(&stamp[d], __ATOMIC_RELAXED);
+        return old != round && __atomic_compare_exchange_n(&stamp[d], &old, round, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (counters[d].decrement_until(k)) crossed[d] = true;
+        if (stamp[d] == round) return false;
+        stamp[d] = round;
+        return true;
+    }
+    inline bool cond(uintE d) { return !peeled[d]; }
+};
+
+// 按计数器值分桶的惰性桶队列 (和 julienne 的 vertex buckets 同样的思路):
+//   - 计数器变了的点插入到新值对应的桶，旧桶里的条目不删；出桶时只保留 valid(v, 桶号) 的点。
+//     计数器只减不增，所以每个点最多只有一个有效条目
+//   - 只展开 [base, base + kWindow) 这些桶，更大的值连同插入时的值放在 overflow 里，
+//     窗口用完时从 overflow 里取最小的有效值重新开窗口
+struct lazy_buckets {
+    static constexpr size_t kWindow = 128;
+    size_t base = 0, cur = 0;
+    std::vector<sequence<uintE>> window;
+    sequence<std::pair<uintE, uintE>> overflow;      // (点, 插入时的值)
+
+    lazy_buckets() : window(kWindow) {}
+
+    void insert(const sequence<std::pair<uintE, uintE>>& items) {
+        auto far = parlay::filter(items, [&](const std::pair<uintE, uintE>& p) { return p.second >= base + kWindow; });
+        overflow.append(far);
+        auto near = parlay::integer_sort(parlay::filter(items, [&](const std::pair<uintE, uintE>& p) { return p.second < base + kWindow; }),
+                                         [&](const std::pair<uintE, uintE>& p) { return p.second - base; });
+        auto starts = parlay::pack_index<size_t>(parlay::delayed_seq<bool>(near.size(), [&](size_t i) {
+            return i == 0 || near[i].second != near[i - 1].second;
+        }));
+        parallel_for(0, starts.size(), [&](size_t r) {     // 每段对应一个不同的桶
+            size_t i = starts[r], j = (r + 1 < starts.size()) ? starts[r + 1] : near.size();
+            auto& bkt = window[near[i].second - base];
+            size_t old = bkt.size();
+            bkt.resize(old + (j - i));
+            parallel_for(i, j, [&](size_t t) { bkt[old + t - i] = near[t].first; });
+        }, 1);
+    }
+
+    // 最小的有效非空桶: (桶号, 点)。全部取完时桶号为 UINT_E_MAX
+    template <class Valid>
+    std::pair<uintE, sequence<uintE>> next(Valid valid) {
+        while (true) {
+            for (; cur < base + kWindow; cur++) {
+                auto& bkt = window[cur - base];
+                if (bkt.size() == 0) continue;
+                uintE id = static_cast<uintE>(cur);
+                auto vs = parlay::filter(bkt, [&](uintE v) { return valid(v, id); });
+                bkt = sequence<uintE>();
+                if (vs.size() > 0) { cur++; return {id, std::move(vs)}; }
+            }
+            overflow = parlay::filter(overflow, [&](const std::pair<uintE, uintE>& p) { return valid(p.first, p.second); });
+            if (overflow.size() == 0) return {UINT_E_MAX, sequence<uintE>()};
+            base = cur = parlay::reduce(parlay::delayed_seq<uintE>(overflow.size(), [&](size_t i) { return overflow[i].second; }),
+                                        parlay::minm<uintE>());
+            auto items = std::move(overflow);
+            overflow = sequence<std::pair<uintE, uintE>>();
+            insert(items);
+        }
+    }
+};
+
+template <class C, class Graph>
+inline sequence<uintE> KCore(Graph& G) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto counters = parlay::tabulate<C>(n, [&](size_t i){
+        return C(static_cast<int>(G.get_vertex(i).out_neighbors().get_degree()));
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    auto coreness = sequence<uintE>(n, 0);
+    auto peeled = sequence<bool>(n, false);
+    auto crossed = sequence<bool>(n, false);
+    auto stamp = sequence<uintE>(n, 0);
+    auto key_of = [&](uintE v) { return std::make_pair(v, static_cast<uintE>(counters[v].get())); };
+    lazy_buckets buckets;
+    buckets.insert(parlay::tabulate(n, [&](size_t i) { return key_of(static_cast<uintE>(i)); }));
+    auto valid = [&](uintE v, uintE id) { return !peeled[v] && static_cast<uintE>(counters[v].get()) == id; };
+    auto frontier = vertexSubset(n);
+    int k = 0;
+    size_t rounds = 0, levels = 0, finished = 0;
+    while (finished < n) {
+        timer nr; nr.start();
+        if (frontier.size() == 0) {                                                      // 进入下一层: 最小的非空桶
+            auto bkt = buckets.next(valid);
+            k = static_cast<int>(bkt.first);
+            frontier = vertexSubset(n, std::move(bkt.second));
+            levels++;
+        }
+        vertexMap(frontier, [&](uintE v) { peeled[v] = true; coreness[v] = k; });        // frontier剥掉
+        finished += frontier.size();
+        rounds++;
+        auto touched = edgeMap(G, frontier, peel_f<W, C>(counters.begin(), peeled.begin(), crossed.begin(), stamp.begin(), k, rounds), -1, sparse_blocked); // 邻居减一
+        touched.toSparse();
+        auto ts = parlay::tabulate(touched.size(), [&](size_t i) { return touched.vtx(i); });
+        auto next = vertexSubset(n, parlay::filter(ts, [&](uintE v) { return crossed[v]; }));        // 跨过 k 的进入下一轮
+        buckets.insert(parlay::map(parlay::filter(ts, [&](uintE v) { return !crossed[v]; }), key_of)); // 其余的换桶
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(frontier.size(), 0, telemetry::edges(G, frontier), rt);
+        frontier = std::move(next);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    std::cout << "## rounds = " << rounds << " levels = " << levels << std::endl;
+    std::cout << "## Max core = " << k << std::endl;
+    return coreness;
+}
+
+// 串行 Batagelj–Zaversnik 桶排序剥离，用来验证
+template <class Graph>
+inline sequence<uintE> sequential_coreness(Graph& G) {
+    using W = typename Graph::weight_type;
+    size_t n = G.n;
+    std::vector<size_t> deg(n), pos(n), vert(n);
+    size_t max_deg = 0;
+    for (size_t v = 0; v < n; v++) { deg[v] = G.get_vertex(v).out_neighbors().get_degree(); max_deg = std::max(max_deg, deg[v]); }
+    std::vector<size_t> bin(max_deg + 2, 0);
+    for (size_t v = 0; v < n; v++) bin[deg[v]]++;
+    for (size_t d = 0, start = 0; d <= max_deg; d++) { size_t num = bin[d]; bin[d] = start; start += num; }
+    for (size_t v = 0; v < n; v++) { pos[v] = bin[deg[v]]++; vert[pos[v]] = v; }
+    for (size_t d = max_deg; d > 0; d--) bin[d] = bin[d - 1];
+    bin[0] = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t v = vert[i];
+        auto f = [&](uintE src, uintE u, const W& wgh) {
+            if (deg[u] > deg[v]) {
+                size_t du = deg[u], pu = pos[u], pw = bin[du], w = vert[pw];
+                if (u != w) { pos[u] = pw; vert[pu] = w; pos[w] = pu; vert[pw] = u; }
+                bin[du]++; deg[u]--;
+            }
+        };
+        G.get_vertex(v).out_neighbors().map(f, false);
+    }
+    return parlay::tabulate(n, [&](size_t v) { return static_cast<uintE>(deg[v]); });
+}
+
+
+}  // namespace KCore_rootset
+}  // namespace gbbs
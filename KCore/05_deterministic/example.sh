@@ -0,0 +1,7 @@
+cd ../..
+bazel build //KCore/05_deterministic:KCore_main -c opt
+# bazel-bin/KCore/05_deterministic/KCore_main -s -b -verify utils/small_graph.bin
+# 其它计数器: KCore_perthread_main / KCore_double_main / KCore_concurrent_main
+# bazel build //KCore/05_deterministic:KCore_double_main -c opt && bazel-bin/KCore/05_deterministic/KCore_double_main -s -b -verify utils/small_graph.bin
+bazel-bin/KCore/05_deterministic/KCore_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd KCore/05_deterministic
\ No newline at end of file
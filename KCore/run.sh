@@ -0,0 +1 @@
+python3 ../utils/run_app.py KCore 05_deterministic 0
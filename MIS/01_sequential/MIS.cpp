@@ -109,10 +109,10 @@ int main(int argc, char* argv[]) {
     if (argc < 2 || argc > 3) { std::cerr << "Usage: ./mis input_graph [verify]" << std::endl; return 1; }
     const char* filename = argv[1];
     Graph<uint32_t, uint64_t> G;
-    G.read_graph(filename);
+    G.read_symmetric_graph(filename);
+    std::cout << "## Graph load time = " << G.load_time << "\n";
     std::string graphname = std::filesystem::path(filename).stem().string();
     //std::cout << "无向图：" << is_undirected_graph(G) << std::endl;
-    if (!G.symmetrized) { G = make_symmetrized(G); }
     // Warm up
     { auto tmp = MIS(G); }
     // Test
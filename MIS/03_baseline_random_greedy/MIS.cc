@@ -35,6 +35,7 @@
 //     -specfor : run the speculative_for based algorithm from pbbs
 
 #include "MIS.h"
+#include "telemetry.h"
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -73,6 +74,8 @@ double MaximalIndependentSet_runner(Graph& G, commandLine P) {
   std::cout << "### Threads: " << num_workers() << std::endl;
   std::cout << "### n: " << G.n << std::endl;
   std::cout << "### m: " << G.m << std::endl;
+  std::string json = P.getOptionValue("-json", "");
+  telemetry::enable(!json.empty());
   std::cout << "### Params: -specfor (deterministic reservations) = " << spec_for << std::endl;
   std::cout << "### Params: -verify  (deterministic reservations) = " << verify  << std::endl;
   std::cout << "### ------------------------------------" << std::endl;
@@ -117,6 +120,8 @@ double MaximalIndependentSet_runner(Graph& G, commandLine P) {
   }
 
   std::cout << "### Running Time: " << tt << std::endl;
+  telemetry::finish(tt);
+  if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "03_baseline_random_greedy", G.n, G.m, size_t(num_workers()), 0});
   return tt;
 }
 
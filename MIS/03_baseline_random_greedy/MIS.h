@@ -25,6 +25,7 @@
 
 #include "gbbs/gbbs.h"
 #include "gbbs/helpers/speculative_for.h"
+#include "telemetry.h"
 
 namespace gbbs {
 namespace MaximalIndependentSet_rootset {
@@ -141,7 +142,9 @@ inline sequence<bool> MaximalIndependentSet(Graph& G) {
     };
     priorities[i] = G.get_vertex(i).out_neighbors().count(count_f);
   });
-  std::cout << "## Counter initialization time = " << init_t.stop() << "\n";
+  double init_time = init_t.stop();
+  std::cout << "## Counter initialization time = " << init_time << "\n";
+  telemetry::init(init_time);
 
   // compute the initial rootset
   // 惰性队列，不存储，只在使用时计算
@@ -183,9 +186,14 @@ inline sequence<bool> MaximalIndependentSet(Graph& G) {
     finished += roots.size();
     finished += removed.size();
 
+    double rt = nr.stop();
+    if (telemetry::enabled()) {
+      telemetry::round(roots.size(), removed.size(),
+                       telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+    }
     roots = std::move(new_roots);
     rounds++;
-    std::cout << "## round = " << rounds << " time = " << nr.stop() << "\n";
+    std::cout << "## round = " << rounds << " time = " << rt << "\n";
   }
   return in_mis;
 }
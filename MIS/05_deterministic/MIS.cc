@@ -1,4 +1,5 @@
 #include "MIS.h"
+#include "telemetry.h"
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -29,11 +30,25 @@ double MaximalIndependentSet_runner(Graph& G, commandLine P) {
     std::cout << "### Threads: " << num_workers() << std::endl;
     std::cout << "### n: " << G.n << std::endl;
     std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    mem_stats::enable(P.getOption("-mem"));
+    std::string cache_dir = P.getOptionValue("-cache", "");
     std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
-
-    double tt = 0.0; timer t; t.start();
-    auto MaximalIndependentSet = MaximalIndependentSet_rootset::MaximalIndependentSet(G);
-    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    std::cout << "### Params: -cache = " << cache_dir << std::endl;
+    std::string trace_path = P.getOptionValue("-trace", "");
+    if (!trace_path.empty()) {
+        if (trace::kEnabled) trace::start();
+        else std::cout << "## -trace ignored: build with --config=trace" << std::endl;
+    }
+    std::string cache = cache_dir.empty() ? "" : cache_dir + "/" + get_graphname(P.getArgument(0)) + ".snapshot";
+
+    double tt = 0.0, write_time = 0.0; timer t; t.start();
+    auto MaximalIndependentSet = MaximalIndependentSet_rootset::MaximalIndependentSet(G, cache, P.getArgument(0), &write_time);
+    tt = t.stop() - write_time; std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!trace_path.empty()) trace::flush(trace_path);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "05_deterministic", G.n, G.m, size_t(num_workers()), 0});
 
     if (P.getOption("-verify")) print_mis(MaximalIndependentSet, "05_deterministic", get_graphname(P.getArgument(0)));
     return tt;
@@ -1,6 +1,10 @@
 #pragma once
 #include "gbbs/gbbs.h"
 #include "deterministic_counter.h"
+#include "snapshot_cache.h"
+#include "telemetry.h"
+#include "mem_stats.h"
+#include "trace.h"
 
 namespace gbbs {
 namespace MaximalIndependentSet_rootset {
@@ -31,38 +35,87 @@ struct mis_f {
 };
 
 
+// cache 不为空时，perm 和初始计数器从 snapshot 文件读取 (见 include/snapshot_cache.h)，
+// 文件不存在或和图 / seed 不匹配时照常计算并写入。写文件的时间记在 write_time 里，由调用者从运行时间中扣掉。
 template <class Graph>
-inline sequence<bool> MaximalIndependentSet(Graph& G) {
+inline sequence<bool> MaximalIndependentSet(Graph& G, const std::string& cache = "", const std::string& graph_path = "",
+                                            double* write_time = nullptr) {
     using W = typename Graph::weight_type;
 
+    mem_stats::checkpoint("load");
     // 初始化计数器
     timer t1; t1.start();
     size_t n = G.n;
-    auto perm = parlay::random_permutation<uintE>(n);
-    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
-        uintE our_pri = perm[i];
-        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
-        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
-        return Counter(cnt);
-    });
-    std::cout << "## Counter initialization time = " << t1.stop() << std::endl;
+    sequence<uintE> perm;
+    sequence<Counter> counters;
+    uint64_t fp = cache.empty() ? 0 : snapshot_cache::fingerprint(G, graph_path);
+    auto snap = cache.empty() ? snapshot_cache::snapshot() : snapshot_cache::load(cache, n, G.m, 0, fp);
+    if (snap) {
+        perm = sequence<uintE>(snap.perm, snap.perm + n);
+        counters = parlay::tabulate<Counter>(n, [&](size_t i) { return Counter(snap.counts[i]); });
+    } else {
+        perm = parlay::random_permutation<uintE>(n);
+        trace::phase tp("init tabulate");
+        counters = parlay::tabulate<Counter>(n, trace::wrap([&](size_t i){
+            uintE our_pri = perm[i];
+            auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+            int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+            return Counter(cnt);
+        }));
+        tp.end();
+    }
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+    mem_stats::checkpoint("init");
+    if (!cache.empty()) {
+        std::cout << "## Snapshot " << (snap ? "warm" : "cold") << " init time = " << init_time << std::endl;
+        if (!snap) {
+            timer ts; ts.start();
+            bool ok = snapshot_cache::store(cache, n, G.m, 0, fp, perm.begin(), [&](size_t i) { return counters[i].value; });
+            double wt = ts.stop();
+            if (write_time) *write_time += wt;
+            std::cout << "## Snapshot write " << (ok ? "ok" : "failed") << " time = " << wt << std::endl;
+        }
+    }
 
     // 初始化frontier(rootset): counter为0的点
+    trace::phase tp("pack roots");
     auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
-        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+        parlay::delayed_seq<bool>(n, trace::wrap([&](size_t i) { return !counters[i].not_zero(); }))
     )));
+    tp.end();
 
     // parallel MIS
     auto in_mis = sequence<bool>(n, false);
-    size_t rounds = 0, finished = 0;
+    size_t rounds = 0, finished = 0, max_frontier = 0;
     while (finished != n && roots.size() > 0) {
         timer nr; nr.start();
-        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
-        auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
-        auto new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots        
+        // trace::phase 只在 -DMIS_TRACE 时记录 (见 include/trace.h)，否则是空操作
+        trace::phase p1("vertexMap", rounds + 1);
+        vertexMap(roots, trace::wrap([&](uintE v) { in_mis[v] = true; }));                            // roots加入MIS
+        p1.end();
+        trace::phase p2("neighbor_map", rounds + 1);
+        auto removed = neighbor_map(G, roots, trace::wrap(GetNghs<decltype(counters), W>(counters))); // 获得 roots 的邻居，并把这些邻居的计数器清零
+        p2.end();
+        trace::phase p3("decrement edgeMap", rounds + 1);
+        auto new_roots = edgeMap(G, removed, trace::wrap(mis_f<W>(counters.begin(), perm.begin())), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+        p3.end();
         rounds++; finished += (roots.size() + removed.size());
+        max_frontier = std::max(max_frontier, roots.size() + removed.size() + new_roots.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
         roots = std::move(new_roots);
-        std::cout << "## round = " << rounds << " time = " << nr.stop() << "\n";
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    mem_stats::checkpoint("rounds");
+    if (mem_stats::enabled()) {                 // 各数据结构的字节数 (frontier 按稀疏表示的最大值估计)
+        mem_stats::add("graph", mem_stats::graph_bytes(G));
+        mem_stats::add("perm", mem_stats::bytes(perm));
+        mem_stats::add("counters", mem_stats::counter_bytes(counters));
+        mem_stats::add("frontiers (max)", max_frontier * sizeof(uintE));
+        mem_stats::add("in_mis", mem_stats::bytes(in_mis));
+        mem_stats::report(n);
     }
     return in_mis;
 }
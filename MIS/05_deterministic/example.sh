@@ -1,5 +1,7 @@
 cd ../..
 bazel build //MIS/05_deterministic:MIS_main -c opt
 # bazel-bin/MIS/05_deterministic/MIS_main -s -b utils/small_graph.bin
+# bazel-bin/MIS/05_deterministic/MIS_main -s -b -rounds 3 -cache /tmp utils/small_graph.bin
+# bazel build --config=trace //MIS/05_deterministic:MIS_main && bazel-bin/MIS/05_deterministic/MIS_main -s -b -rounds 1 -trace mis_trace.json utils/small_graph.bin
 bazel-bin/MIS/05_deterministic/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
 cd MIS/05_deterministic
\ No newline at end of file
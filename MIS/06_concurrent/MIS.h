@@ -1,6 +1,8 @@
 #pragma once
 #include "gbbs/gbbs.h"
 #include "concurrent_counter.h"
+#include "telemetry.h"
+#include "mem_stats.h"
 
 namespace gbbs {
 namespace MaximalIndependentSet_rootset {
@@ -36,6 +38,7 @@ template <class Graph>
 inline sequence<bool> MaximalIndependentSet(Graph& G) {
     using W = typename Graph::weight_type;
 
+    mem_stats::checkpoint("load");
     // 初始化计数器
     timer t1; t1.start();
     size_t n = G.n;
@@ -46,7 +49,10 @@ inline sequence<bool> MaximalIndependentSet(Graph& G) {
         int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
         return Counter(cnt);
     });
-    std::cout << "## Counter initialization time = " << t1.stop() << std::endl;
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+    mem_stats::checkpoint("init");
 
     // 初始化frontier(rootset): counter为0的点
     auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
@@ -55,15 +61,27 @@ inline sequence<bool> MaximalIndependentSet(Graph& G) {
 
     // parallel MIS
     auto in_mis = sequence<bool>(n, false);
-    size_t rounds = 0, finished = 0;
+    size_t rounds = 0, finished = 0, max_frontier = 0;
     while (finished != n && roots.size() > 0) {
         timer nr; nr.start();
         vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
         auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
         auto new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots        
         rounds++; finished += (roots.size() + removed.size());
+        max_frontier = std::max(max_frontier, roots.size() + removed.size() + new_roots.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
         roots = std::move(new_roots);
-        std::cout << "## round = " << rounds << " time = " << nr.stop() << "\n";
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    mem_stats::checkpoint("rounds");
+    if (mem_stats::enabled()) {                 // 各数据结构的字节数 (frontier 按稀疏表示的最大值估计)
+        mem_stats::add("graph", mem_stats::graph_bytes(G));
+        mem_stats::add("perm", mem_stats::bytes(perm));
+        mem_stats::add("counters", mem_stats::counter_bytes(counters));
+        mem_stats::add("frontiers (max)", max_frontier * sizeof(uintE));
+        mem_stats::add("in_mis", mem_stats::bytes(in_mis));
+        mem_stats::report(n);
     }
     return in_mis;
 }
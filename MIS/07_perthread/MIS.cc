@@ -1,4 +1,5 @@
 #include "MIS.h"
+#include "telemetry.h"
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -29,11 +30,16 @@ double MaximalIndependentSet_runner(Graph& G, commandLine P) {
     std::cout << "### Threads: " << num_workers() << std::endl;
     std::cout << "### n: " << G.n << std::endl;
     std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    mem_stats::enable(P.getOption("-mem"));
     std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
 
     double tt = 0.0; timer t; t.start();
     auto MaximalIndependentSet = MaximalIndependentSet_rootset::MaximalIndependentSet(G);
     tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "07_perthread", G.n, G.m, size_t(num_workers()), 0});
 
     if (P.getOption("-verify")) print_mis(MaximalIndependentSet, "07_perthread", get_graphname(P.getArgument(0)));
     return tt;
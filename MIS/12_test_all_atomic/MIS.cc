@@ -1,4 +1,5 @@
 #include "MIS.h"
+#include "telemetry.h"
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -29,11 +30,15 @@ double MaximalIndependentSet_runner(Graph& G, commandLine P) {
     std::cout << "### Threads: " << num_workers() << std::endl;
     std::cout << "### n: " << G.n << std::endl;
     std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
     std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
 
     double tt = 0.0; timer t; t.start();
     auto MaximalIndependentSet = MaximalIndependentSet_rootset::MaximalIndependentSet(G);
     tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "12_test_all_atomic", G.n, G.m, size_t(num_workers()), 0});
 
     if (P.getOption("-verify")) print_mis(MaximalIndependentSet, "12_test_all_atomic", get_graphname(P.getArgument(0)));
     return tt;
@@ -1,6 +1,7 @@
 #pragma once
 #include "gbbs/gbbs.h"
 #include "12_test_all_atomic.h"
+#include "telemetry.h"
 
 namespace gbbs {
 namespace MaximalIndependentSet_rootset {
@@ -45,7 +46,9 @@ inline sequence<bool> MaximalIndependentSet(Graph& G) {
         int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
         return Counter(cnt);
     });
-    std::cout << "## Counter initialization time = " << t1.stop() << std::endl;
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
 
     // 初始化frontier(rootset): counter为0的点
     auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
@@ -61,8 +64,10 @@ inline sequence<bool> MaximalIndependentSet(Graph& G) {
         auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
         auto new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots        
         rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
         roots = std::move(new_roots);
-        std::cout << "## round = " << rounds << " time = " << nr.stop() << "\n";
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
     }
     return in_mis;
 }
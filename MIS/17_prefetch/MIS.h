@@ -0,0 +1,83 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "prefetch_edge_map.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+template <class P, class W>
+struct GetNghs {
+    P& p;
+    GetNghs(P& p) : p(p) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return p[d].set_zero_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return p[d].set_zero(); }
+    inline bool cond(uintE d) { return p[d].not_zero(); }
+    inline void prefetch(uintE d) const { __builtin_prefetch(&p[d], 1); }
+};
+
+template <class W>
+struct mis_f {
+    Counter* counters;
+    uintE* perm;
+    mis_f(Counter* _counters, uintE* _perm) : counters(_counters), perm(_perm) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { 
+        if (perm[s] < perm[d]) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+    inline void prefetch(uintE d) const { __builtin_prefetch(perm + d, 0); __builtin_prefetch(counters + d, 1); }
+};
+
+
+// K = 0: GBBS 的 neighbor_map / edgeMap; K > 0: 每批 K 条边的软件预取遍历
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, size_t K) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    // parallel MIS
+    auto in_mis = sequence<bool>(n, false);
+    size_t rounds = 0, finished = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
+        auto get_nghs = GetNghs<decltype(counters), W>(counters);
+        auto removed = K ? prefetch_edge_map(G, roots, get_nghs, K) : neighbor_map(G, roots, get_nghs);  // 获得 roots 的邻居，并把这些邻居的计数器清零
+        auto dec = mis_f<W>(counters.begin(), perm.begin());
+        auto new_roots = K ? prefetch_edge_map(G, removed, dec, K) : edgeMap(G, removed, dec, -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
@@ -0,0 +1,4 @@
+cd ../..
+bazel build //MIS/17_prefetch:MIS_main -c opt
+bazel-bin/MIS/17_prefetch/MIS_main -s -b -prefetch 16 utils/small_graph.bin
+cd MIS/17_prefetch
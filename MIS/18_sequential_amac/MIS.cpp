@@ -0,0 +1,159 @@
+#include "graph_utils/graph.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+#include <filesystem>
+using namespace parlay;
+
+// 和 01_sequential 相同的贪心 MIS，但按 AMAC 的方式把 depth 个顶点同时放在流水线里：
+//   第 i + depth 个顶点: 预取 removed[u] 和 offsets[u]
+//   第 i + depth/2 个顶点: offsets 已在缓存中，若 u 尚未被移除则预取它的邻接表
+//   第 i 个顶点: 真正做决定（严格按优先级顺序，所以结果和 01 完全一致）
+// 标记邻居时也提前 kEdgeAhead 条边预取 removed[v]。
+template <class Graph>
+std::vector<typename Graph::NodeId> MIS(const Graph &G, size_t depth) {
+    using NodeId = typename Graph::NodeId;
+    constexpr size_t kEdgeAhead = 8;
+    size_t n = G.n;
+    size_t half = depth / 2;
+
+    // Create a permutation to randomize vertex processing order (like GBBS)
+    auto perm = parlay::random_permutation<NodeId>(n);
+    std::vector<size_t> priority(n);
+    for (size_t i = 0; i < n; ++i) { priority[perm[i]] = i;}
+
+    // uint8_t 而不是 vector<bool>，这样才能按地址预取
+    std::vector<uint8_t> in_MIS(n, 0);
+    std::vector<uint8_t> removed(n, 0);
+
+    // in default permuted order
+    for (size_t i = 0; i < n; i++) {
+        if (depth > 0 && i + depth < n) {
+            NodeId w = priority[i + depth];
+            __builtin_prefetch(&removed[w]);
+            __builtin_prefetch(&G.offsets[w]);
+        }
+        if (half > 0 && i + half < n) {
+            NodeId w = priority[i + half];
+            if (!removed[w]) __builtin_prefetch(G.edges.begin() + G.offsets[w]);
+        }
+        NodeId u = priority[i];
+        if (!removed[u]) {
+            // Add this vertex 
+            in_MIS[u] = 1;
+            removed[u] = 1;
+            // Mark neighbors as removed
+            size_t begin = G.offsets[u], end = G.offsets[u + 1];
+            for (size_t e = begin; e < end; e++) {
+                if (e + kEdgeAhead < end) __builtin_prefetch(&removed[G.edges[e + kEdgeAhead].v], 1);
+                NodeId v = G.edges[e].v;
+                removed[v] = 1;
+            }
+        }
+    }
+
+
+    std::vector<NodeId> result;
+    for (NodeId u = 0; u < n; u++) {
+        if (in_MIS[u]) result.push_back(u);
+    }
+    return result;
+}
+
+bool is_undirected_graph(const Graph<uint32_t, uint64_t> &G) {
+    using NodeId = uint32_t;
+    using EdgeId = uint64_t;
+
+    std::unordered_set<uint64_t> edge_set;
+    edge_set.reserve(G.m * 2);
+
+    auto encode = [&](NodeId u, NodeId v) -> uint64_t {
+        return (uint64_t(u) << 32) | uint64_t(v);
+    };
+
+    // 先把所有 u->v 边加入 hash set
+    for (NodeId u = 0; u < G.n; u++) {
+        for (EdgeId e = G.offsets[u]; e < G.offsets[u + 1]; e++) {
+            NodeId v = G.edges[e].v;
+            edge_set.insert(encode(u, v));
+        }
+    }
+
+    // 检查每一条 u->v 是否存在 v->u
+    for (NodeId u = 0; u < G.n; u++) {
+        for (EdgeId e = G.offsets[u]; e < G.offsets[u + 1]; e++) {
+            NodeId v = G.edges[e].v;
+            if (edge_set.find(encode(v, u)) == edge_set.end()) {
+                std::cerr << "Missing reverse edge: " << u << " -> " << v 
+                          << " but no " << v << " -> " << u << "\n";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <class NodeId>
+void save_mis_to_file(const std::vector<NodeId>& mis_set, const std::string& filename) {
+    auto sorted_mis = mis_set;
+    std::sort(sorted_mis.begin(), sorted_mis.end());
+
+    // Create directory if needed
+    size_t last_slash = filename.find_last_of('/');
+    if (last_slash != std::string::npos) {
+        std::string dir = filename.substr(0, last_slash);
+        system(("mkdir -p " + dir).c_str());
+    }
+
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        std::cerr << "Error: Cannot open output file " << filename << std::endl;
+        return;
+    }
+
+    out << sorted_mis.size();
+    for (const auto& v : sorted_mis) {
+        out << "," << v;
+    }
+    out.close();
+    // std::cout << "MIS result saved to " << filename << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 4) { std::cerr << "Usage: ./mis input_graph [verify] [depth]" << std::endl; return 1; }
+    const char* filename = argv[1];
+    size_t depth = (argc == 4) ? std::atoi(argv[3]) : 16;
+    Graph<uint32_t, uint64_t> G;
+    G.read_symmetric_graph(filename);
+    std::cout << "## Graph load time = " << G.load_time << "\n";
+    std::string graphname = std::filesystem::path(filename).stem().string();
+    //std::cout << "无向图：" << is_undirected_graph(G) << std::endl;
+    // Warm up
+    { auto tmp = MIS(G, depth); }
+    // Test
+    
+    std::vector<double> times;
+    //std::cout << graphname << "    ";
+    for (int run = 1; run <= 3; run++) {
+        internal::timer t;
+        auto mis_set = MIS(G, depth);
+        t.stop();
+        times.push_back(t.total_time());
+    }
+    double avg_time = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    std::cout << avg_time << "\n";
+    // Verify
+    bool verify = false;
+    if (argc >= 3) verify = (std::atoi(argv[2]) != 0);
+    if (verify) {
+        auto mis_set = MIS(G, depth);
+        std::string output_file = "./output/" + graphname + ".txt";
+        save_mis_to_file(mis_set, output_file);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,2 @@
+make
+./MIS ../../utils/small_graph.bin 0 16
\ No newline at end of file
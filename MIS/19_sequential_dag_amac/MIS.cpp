@@ -0,0 +1,164 @@
+#include "graph_utils/graph.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+#include <filesystem>
+// #include <vector>
+using namespace parlay;
+
+// 和 02_sequential_dag 相同的算法和结果，只是让 depth 个顶点的访存同时在路上（AMAC 式流水线）：
+//   计数阶段按 CSR 顺序扫边，提前 depth 条边预取 perm[v]
+//   处理 roots / removed 里的第 k 个点时，预取第 k + depth 个点的 offsets、第 k + depth/2 个点的邻接表
+//   扫一个点的邻接表时，提前 kEdgeAhead 条边预取 priorities[v]（和 perm[v]）
+template <class Graph>
+parlay::sequence<typename Graph::NodeId> MIS(const Graph &G, size_t depth) {
+    using NodeId = typename Graph::NodeId;
+    constexpr size_t kEdgeAhead = 8;
+    size_t n = G.n;
+    size_t m = G.edges.size();
+    size_t half = depth / 2;
+
+    auto perm = parlay::random_permutation<NodeId>(n);
+
+    auto stage = [&](const parlay::sequence<NodeId>& list, size_t k) {
+        if (depth > 0 && k + depth < list.size()) __builtin_prefetch(&G.offsets[list[k + depth]]);
+        if (half > 0 && k + half < list.size()) __builtin_prefetch(G.edges.begin() + G.offsets[list[k + half]]);
+    };
+
+    parlay::sequence<int> priorities(n);
+    for (NodeId u = 0; u < n; u++) {
+        int count = 0;
+        for (size_t e = G.offsets[u]; e < G.offsets[u+1]; e++) {
+            if (e + depth < m) __builtin_prefetch(&perm[G.edges[e + depth].v]);
+            NodeId v = G.edges[e].v;
+            if (perm[v] < perm[u]) count++;
+        }
+        priorities[u] = count;
+    }
+
+    parlay::sequence<bool> in_mis(n, false);
+    parlay::sequence<bool> excluded(n, false);
+    size_t finished = 0;
+
+    while (finished < n) {
+        parlay::sequence<NodeId> roots;
+        for (NodeId u = 0; u < n; u++) {
+            if (priorities[u] == 0 && !in_mis[u] && !excluded[u]) {
+                roots.push_back(u);
+            }
+        }
+
+        if (roots.empty()) break;
+
+        for (NodeId u : roots) {
+            in_mis[u] = true;
+        }
+
+        parlay::sequence<bool> removed_mark(n, false);
+        parlay::sequence<NodeId> removed;
+        for (size_t k = 0; k < roots.size(); k++) {
+            stage(roots, k);
+            NodeId u = roots[k];
+            size_t end = G.offsets[u+1];
+            for (size_t e = G.offsets[u]; e < end; e++) {
+                if (e + kEdgeAhead < end) __builtin_prefetch(&priorities[G.edges[e + kEdgeAhead].v], 1);
+                NodeId v = G.edges[e].v;
+                if (priorities[v] > 0 && !removed_mark[v]) {
+                    removed.push_back(v);
+                    removed_mark[v] = true;
+                    excluded[v] = true;
+                    priorities[v] = 0;
+                }
+            }
+        }
+
+        for (size_t k = 0; k < removed.size(); k++) {
+            stage(removed, k);
+            NodeId u = removed[k];
+            size_t end = G.offsets[u+1];
+            for (size_t e = G.offsets[u]; e < end; e++) {
+                if (e + kEdgeAhead < end) {
+                    NodeId w = G.edges[e + kEdgeAhead].v;
+                    __builtin_prefetch(&priorities[w], 1);
+                    __builtin_prefetch(&perm[w]);
+                }
+                NodeId v = G.edges[e].v;
+                if (priorities[v] > 0 && perm[u] < perm[v]) {
+                    priorities[v]--;
+                }
+            }
+        }
+
+        finished += roots.size();
+        finished += removed.size();
+    }
+
+    parlay::sequence<NodeId> result;
+    for (NodeId u = 0; u < n; u++) {
+        if (in_mis[u]) result.push_back(u);
+    }
+    return result;
+}
+
+template <class Container>
+void save_mis_to_file(const Container& mis_set, const std::string& filename) {
+    using NodeId = typename Container::value_type;
+    std::vector<NodeId> sorted_mis(mis_set.begin(), mis_set.end());
+    std::sort(sorted_mis.begin(), sorted_mis.end());
+
+    // Create directory if needed
+    size_t last_slash = filename.find_last_of('/');
+    if (last_slash != std::string::npos) {
+        std::string dir = filename.substr(0, last_slash);
+        system(("mkdir -p " + dir).c_str());
+    }
+
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        std::cerr << "Error: Cannot open output file " << filename << std::endl;
+        return;
+    }
+
+    out << sorted_mis.size();
+    for (const auto& v : sorted_mis) {
+        out << "," << v;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 4) { std::cerr << "Usage: ./mis input_graph [verify] [depth]" << std::endl; return 1; }
+    const char* filename = argv[1];
+    size_t depth = (argc == 4) ? std::atoi(argv[3]) : 16;
+    Graph<uint32_t, uint64_t> G;
+    G.read_symmetric_graph(filename);
+    std::cout << "## Graph load time = " << G.load_time << "\n";
+    std::string graphname = std::filesystem::path(filename).stem().string();
+    //std::cout << "无向图：" << is_undirected_graph(G) << std::endl;
+    // Warm up
+    { auto tmp = MIS(G, depth); }
+    // Test
+    
+    std::vector<double> times;
+    //std::cout << graphname << "    ";
+    for (int run = 1; run <= 3; run++) {
+        internal::timer t;
+        auto mis_set = MIS(G, depth);
+        t.stop();
+        times.push_back(t.total_time());
+    }
+    double avg_time = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    std::cout << avg_time << "\n";
+    // Verify
+    bool verify = false;
+    if (argc >= 3) verify = (std::atoi(argv[2]) != 0);
+    if (verify) {
+        auto mis_set = MIS(G, depth);
+        std::string output_file = "./output/" + graphname + ".txt";
+        save_mis_to_file(mis_set, output_file);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "MIS.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+template <typename T>
+void print_mis(parlay::sequence<T>& mis, std::string algo, std::string graphname) {
+    std::ofstream out("MIS/" + algo + "/output/" + graphname + ".txt");
+    int cnt = 0; for (size_t i = 0; i < mis.size(); i++) cnt += mis[i]; out << cnt;
+    for (size_t i = 0; i < mis.size(); i++) { if (mis[i]) { out << "," << i; } }
+    out.close();
+}
+
+
+namespace gbbs {
+template <class Graph>
+double MaximalIndependentSet_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: MIS" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    auto policy = placement::parse_numa_policy(P.getOptionValue("-numa", "none"));
+    auto pages = placement::parse_page_mode(P.getOptionValue("-huge", "none"));
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+    std::cout << "### Params: -numa = " << placement::to_string(policy) << " (nodes = " << placement::num_nodes() << ")" << std::endl;
+    std::cout << "### Params: -huge = " << placement::to_string(pages) << std::endl;
+
+    // 不计时: 绑定 worker、打开硬件计数器、把已经读进来的图数组迁移到对应节点
+    // (block 策略下按字节切分 offsets / edges，和按顶点区间切分近似一致)
+    placement::worker_setup workers(policy);
+    placement::report_place("offsets", placement::place(G.v_data, G.n * sizeof(*G.v_data), policy, placement::kMpolMfMove));
+    placement::report_place("edges", placement::place(G.e0, G.m * sizeof(*G.e0), policy, placement::kMpolMfMove));
+    if (policy == placement::numa_policy::block)   // block 只决定页面放在哪，不保证节点上的 worker 处理本节点的顶点
+        std::cout << "## Workers pinned = " << workers.pinned << "/" << num_workers() << std::endl;
+    if (pages != placement::page_mode::small) {
+        placement::advise_huge(G.v_data, G.n * sizeof(*G.v_data));
+        placement::advise_huge(G.e0, G.m * sizeof(*G.e0));
+        std::cout << "## Huge pages (kB): offsets = " << placement::huge_kb(G.v_data, G.n * sizeof(*G.v_data))
+                  << " edges = " << placement::huge_kb(G.e0, G.m * sizeof(*G.e0))
+                  << " process AnonHugePages = " << placement::process_anon_huge_kb() << std::endl;
+    }
+
+    double tt = 0.0; timer t; t.start();
+    workers.start();
+    auto MaximalIndependentSet = MaximalIndependentSet_rootset::MaximalIndependentSet(G, policy, pages);
+    auto hw = workers.stop();
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "20_placement", G.n, G.m, size_t(num_workers()), 0});
+
+    // node-loads: 本节点 DRAM 读, node-load-misses: 跨 socket 读
+    if (workers.numa_available()) {
+        std::cout << "## NUMA node-loads = " << hw.node_loads << " node-load-misses = " << hw.node_misses
+                  << " remote fraction = " << (hw.node_loads + hw.node_misses ? double(hw.node_misses) / (hw.node_loads + hw.node_misses) : 0.0)
+                  << " (workers counted = " << workers.covered << "/" << num_workers() << ")" << std::endl;
+    } else {
+        std::cout << "## NUMA counters unavailable" << std::endl;
+    }
+    if (workers.dtlb_available()) std::cout << "## dTLB load misses = " << hw.dtlb_misses << std::endl;
+
+    if (P.getOption("-verify")) print_mis(MaximalIndependentSet, "20_placement", get_graphname(P.getArgument(0)));
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::MaximalIndependentSet_runner, false);
@@ -0,0 +1,98 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "placement.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+template <class P, class W>
+struct GetNghs {
+    P& p;
+    GetNghs(P& p) : p(p) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return p[d].set_zero_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return p[d].set_zero(); }
+    inline bool cond(uintE d) { return p[d].not_zero(); }
+};
+
+template <class W>
+struct mis_f {
+    Counter* counters;
+    uintE* perm;
+    mis_f(Counter* _counters, uintE* _perm) : counters(_counters), perm(_perm) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (perm[s] < perm[d]) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+};
+
+
+// 和 05_deterministic 相同，只是 perm / counters / in_mis 用 placement::vertex_array 分配，
+// 页面按 policy 放到各个 NUMA 节点上，pages 选择 4KB / THP / hugetlbfs 页
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, placement::numa_policy policy,
+                                            placement::page_mode pages = placement::page_mode::small) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = [&] {
+        auto p = parlay::random_permutation<uintE>(n);
+        return placement::vertex_array<uintE>(n, policy, pages, [&](size_t i) { return p[i]; });
+    }();
+    auto counters = placement::vertex_array<Counter>(n, policy, pages, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    auto in_mis = placement::vertex_array<bool>(n, policy, pages, [](size_t) { return false; });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    placement::report_place("perm", perm.place_error);
+    placement::report_place("counters", counters.place_error);
+    placement::report_place("in_mis", in_mis.place_error);
+
+    // 实际拿到的大页 (首次写入时分配，所以初始化之后统计)
+    if (pages != placement::page_mode::small) {
+        std::cout << "## Huge pages (kB): perm = " << perm.huge_kb() << " counters = " << counters.huge_kb()
+                  << " in_mis = " << in_mis.huge_kb() << " mode = " << placement::to_string(counters.mode) << std::endl;
+    }
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    // parallel MIS
+    size_t rounds = 0, finished = 0;
+    double decrement_time = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
+        auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
+        timer dt; dt.start();
+        auto new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+        decrement_time += dt.stop();
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    std::cout << "## Decrement phase time = " << decrement_time << std::endl;
+    return parlay::tabulate(n, [&](size_t i) { return in_mis[i]; });
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/20_placement:MIS_main -c opt
+# bazel-bin/MIS/20_placement/MIS_main -s -b -numa interleave utils/small_graph.bin
+bazel-bin/MIS/20_placement/MIS_main -s -b -numa block /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/20_placement
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "MIS.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+template <typename T>
+void print_mis(parlay::sequence<T>& mis, std::string algo, std::string graphname) {
+    std::ofstream out("MIS/" + algo + "/output/" + graphname + ".txt");
+    int cnt = 0; for (size_t i = 0; i < mis.size(); i++) cnt += mis[i]; out << cnt;
+    for (size_t i = 0; i < mis.size(); i++) { if (mis[i]) { out << "," << i; } }
+    out.close();
+}
+
+
+namespace gbbs {
+template <class Graph>
+double MaximalIndependentSet_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: MIS" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    std::string pri = P.getOptionValue("-priority", "perm");
+    uint64_t seed = P.getOptionLongValue("-seed", 0);
+    bool count_decs = P.getOption("-count_decs");      // 统计减一总次数 (会进入计时区间)
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+    std::cout << "### Params: -priority = " << pri << std::endl;
+    std::cout << "### Params: -seed = " << seed << std::endl;
+    std::cout << "### Params: -count_decs = " << count_decs << std::endl;
+
+    double tt = 0.0; timer t; t.start();
+    auto MaximalIndependentSet =
+        (pri == "hash")   ? MaximalIndependentSet_rootset::MaximalIndependentSet<priority::hashed>(G, seed, count_decs) :
+        (pri == "degree") ? MaximalIndependentSet_rootset::MaximalIndependentSet<priority::degree>(G, seed, count_decs) :
+        (pri == "kcore")  ? MaximalIndependentSet_rootset::MaximalIndependentSet<priority::kcore>(G, seed, count_decs) :
+                            MaximalIndependentSet_rootset::MaximalIndependentSet<priority::permutation>(G, seed, count_decs);
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "22_priority", G.n, G.m, size_t(num_workers()), seed});
+
+    if (P.getOption("-verify")) print_mis(MaximalIndependentSet, "22_priority", get_graphname(P.getArgument(0)));
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::MaximalIndependentSet_runner, false);
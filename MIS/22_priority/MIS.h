@@ -0,0 +1,101 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "priority.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+template <class P, class W>
+struct GetNghs {
+    P& p;
+    GetNghs(P& p) : p(p) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return p[d].set_zero_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return p[d].set_zero(); }
+    inline bool cond(uintE d) { return p[d].not_zero(); }
+};
+
+struct alignas(64) padded_count { size_t value = 0; };
+
+// perm[s] < perm[d] 换成 pri->before(s, d)；Count 为 true 时 decs 按 worker 统计减一的次数
+// (只在 -count_decs 时打开，默认的计时路径里没有这次 worker_id() 和写)
+template <class W, class Pri, bool Count>
+struct mis_f {
+    Counter* counters;
+    const Pri* pri;
+    padded_count* decs;
+    mis_f(Counter* _counters, const Pri* _pri, padded_count* _decs) : counters(_counters), pri(_pri), decs(_decs) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (pri->before(s, d)) {
+            if constexpr (Count) decs[worker_id()].value++;
+            return counters[d].decrement_atomic();
+        }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (pri->before(s, d)) {
+            if constexpr (Count) decs[worker_id()].value++;
+            return counters[d].decrement();
+        }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+};
+
+
+// 和 05_deterministic 相同，优先级由 Pri 决定 (见 include/priority.h)
+// 额外输出轮数、MIS 大小和 (count_decs 时) 减一总次数，用来比较不同的顺序
+template <class Pri, class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, uint64_t seed, bool count_decs = false) {
+    using W = typename Graph::weight_type;
+
+    // 初始化优先级和计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    timer tp; tp.start();
+    const Pri pri = Pri::build(G, seed);
+    std::cout << "## Priority (" << Pri::name() << ") time = " << tp.stop() << " memory = " << pri.bytes() << " bytes" << std::endl;
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return pri.before(ngh, src);};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    // parallel MIS
+    auto in_mis = sequence<bool>(n, false);
+    auto decs = sequence<padded_count>(num_workers());
+    size_t rounds = 0, finished = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
+        auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
+        auto new_roots = count_decs                                                      // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+            ? edgeMap(G, removed, mis_f<W, Pri, true>(counters.begin(), &pri, decs.begin()), -1, sparse_blocked)
+            : edgeMap(G, removed, mis_f<W, Pri, false>(counters.begin(), &pri, decs.begin()), -1, sparse_blocked);
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    std::cout << "## rounds = " << rounds << std::endl;
+    if (count_decs) {
+        size_t total_decs = 0; for (auto& c : decs) total_decs += c.value;
+        std::cout << "## Total decrements = " << total_decs << std::endl;
+    }
+    std::cout << "## MIS size = " << parlay::count(in_mis, true) << std::endl;
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/22_priority:MIS_main -c opt
+# bazel-bin/MIS/22_priority/MIS_main -s -b -priority hash -seed 1 utils/small_graph.bin
+bazel-bin/MIS/22_priority/MIS_main -s -b -priority hash /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/22_priority
\ No newline at end of file
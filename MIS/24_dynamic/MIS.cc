@@ -0,0 +1,92 @@
+#include "MIS.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+template <typename T>
+void print_mis(parlay::sequence<T>& mis, std::string algo, std::string graphname) {
+    std::ofstream out("MIS/" + algo + "/output/" + graphname + ".txt");
+    int cnt = 0; for (size_t i = 0; i < mis.size(); i++) cnt += mis[i]; out << cnt;
+    for (size_t i = 0; i < mis.size(); i++) { if (mis[i]) { out << "," << i; } }
+    out.close();
+}
+
+
+namespace gbbs {
+// 一批随机更新: 一半删除已有的边，一半插入随机点对
+std::vector<MaximalIndependentSet_rootset::edge_update> random_batch(
+        const MaximalIndependentSet_rootset::dynamic_mis& D, size_t size, uint64_t seed) {
+    std::vector<MaximalIndependentSet_rootset::edge_update> batch;
+    for (size_t i = 0; i < size; i++) {
+        uint64_t h = parlay::hash64(seed * size + i);
+        uintE u = h % D.n;
+        if (i % 2 == 0 && !D.adj[u].empty()) {
+            batch.push_back({u, D.adj[u][parlay::hash64(h) % D.adj[u].size()], false});
+        } else {
+            batch.push_back({u, static_cast<uintE>(parlay::hash64(h) % D.n), true});
+        }
+    }
+    return batch;
+}
+
+template <class Graph>
+double MaximalIndependentSet_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: MIS" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    size_t batches = P.getOptionLongValue("-batches", 10);
+    size_t batch_size = P.getOptionLongValue("-batch_size", 1000);
+    uint64_t seed = P.getOptionLongValue("-seed", 1);
+    bool verify = P.getOption("-verify");
+    std::cout << "### Params: -verify = " << verify << std::endl;
+    std::cout << "### Params: -batches = " << batches << " -batch_size = " << batch_size << " -seed = " << seed << std::endl;
+
+    // 初始的 MIS 和计数器
+    timer t1; t1.start();
+    MaximalIndependentSet_rootset::dynamic_mis D(G);
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // Running Time 只算更新的时间 (生成更新和验证不计时)
+    double tt = 0.0;
+    bool ok = true;
+    for (size_t b = 0; b < batches; b++) {
+        auto batch = random_batch(D, batch_size, seed + b);
+        timer nr; nr.start();
+        D.apply(batch);
+        double bt = nr.stop(); tt += bt;
+        std::cout << "## batch = " << b + 1 << " time = " << bt << " visited = " << D.visited << " scanned = " << D.scanned << "\n";
+        if (verify) {
+            auto expected = D.from_scratch();
+            size_t diff = parlay::count(parlay::delayed_seq<bool>(G.n, [&](size_t i) { return expected[i] != D.in_mis[i]; }), true);
+            if (diff) { std::cout << "## batch " << b + 1 << ": " << diff << " vertices differ from the from-scratch MIS" << std::endl; ok = false; }
+        }
+    }
+    std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "24_dynamic", G.n, G.m, size_t(num_workers()), seed});
+
+    if (verify) {
+        std::cout << "## Verify: " << (ok ? "OK" : "FAILED") << std::endl;
+        print_mis(D.in_mis, "24_dynamic", get_graphname(P.getArgument(0)));
+    }
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::MaximalIndependentSet_runner, false);
@@ -0,0 +1,163 @@
+#pragma once
+#include <algorithm>
+#include <queue>
+#include <vector>
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+template <class P, class W>
+struct GetNghs {
+    P& p;
+    GetNghs(P& p) : p(p) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return p[d].set_zero_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return p[d].set_zero(); }
+    inline bool cond(uintE d) { return p[d].not_zero(); }
+};
+
+template <class W>
+struct mis_f {
+    Counter* counters;
+    uintE* perm;
+    mis_f(Counter* _counters, uintE* _perm) : counters(_counters), perm(_perm) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (perm[s] < perm[d]) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+};
+
+struct edge_update {
+    uintE u, v;
+    bool insert;
+};
+
+// 动态 MIS: 在边的插入 / 删除之后维护和从头计算完全相同的 greedy MIS (同一个 perm)
+//
+// 初始 MIS 用 05_deterministic 的 rootset 算法算出来。之后计数器的含义变成
+//   counters[v] = v 的邻居中 perm 更小且在 MIS 里的个数
+// 所以 in_mis[v] == (counters[v] == 0) 始终成立。一批更新先调整端点的计数器，
+// 不满足这个等式的点按 perm 从小到大出堆处理: 翻转状态，并调整 perm 更大的邻居的计数器。
+// 出堆顺序单调，所以每个点出堆时比它早的点都已经是最终状态，更新的代价只和受影响的区域有关。
+struct dynamic_mis {
+    size_t n;
+    sequence<uintE> perm;
+    sequence<Counter> counters;
+    sequence<bool> in_mis;
+    sequence<std::vector<uintE>> adj;  // 可修改的邻接表，保持有序，查找用二分
+    std::vector<bool> queued;
+    size_t visited = 0;  // 最近一批更新出堆的点数
+    size_t scanned = 0;  // 最近一批更新扫描的边数
+
+    template <class Graph>
+    explicit dynamic_mis(Graph& G) : n(G.n), queued(G.n, false) {
+        using W = typename Graph::weight_type;
+        perm = parlay::random_permutation<uintE>(n);
+        adj = parlay::tabulate(n, [&](size_t i) {
+            auto nghs = G.get_vertex(i).out_neighbors();
+            auto* e = nghs.get_edges();
+            std::vector<uintE> a(nghs.get_degree());
+            for (size_t j = 0; j < a.size(); j++) a[j] = std::get<0>(e[j]);
+            std::sort(a.begin(), a.end());
+            return a;
+        });
+
+        // 和 05_deterministic 相同的 rootset 算法
+        counters = parlay::tabulate<Counter>(n, [&](size_t i){
+            uintE our_pri = perm[i];
+            auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+            return Counter(static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f)));
+        });
+        auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+            parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+        )));
+        in_mis = sequence<bool>(n, false);
+        size_t finished = 0;
+        while (finished != n && roots.size() > 0) {
+            vertexMap(roots, [&](uintE v) { in_mis[v] = true; });
+            auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters));
+            auto new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked);
+            finished += (roots.size() + removed.size());
+            roots = std::move(new_roots);
+        }
+
+        // 计数器改成 “更早的 MIS 邻居个数”
+        counters = parlay::tabulate<Counter>(n, [&](size_t i) {
+            int cnt = 0;
+            for (uintE u : adj[i]) cnt += (in_mis[u] && perm[u] < perm[i]);
+            return Counter(cnt);
+        });
+    }
+
+    inline bool dirty(uintE v) const { return in_mis[v] == counters[v].not_zero(); }
+
+    struct later_first {
+        const uintE* perm;
+        bool operator()(uintE a, uintE b) const { return perm[a] > perm[b]; }
+    };
+    using heap_t = std::priority_queue<uintE, std::vector<uintE>, later_first>;
+
+    void push(heap_t& heap, uintE v) {
+        if (!queued[v] && dirty(v)) { queued[v] = true; heap.push(v); }
+    }
+
+    // 一批边的插入 / 删除。重复插入、删除不存在的边和自环都忽略。
+    void apply(const std::vector<edge_update>& batch) {
+        heap_t heap(later_first{perm.begin()});
+        visited = scanned = 0;
+        for (const auto& e : batch) {
+            if (e.u == e.v) continue;
+            auto& au = adj[e.u];
+            auto it = std::lower_bound(au.begin(), au.end(), e.v);
+            if (e.insert == (it != au.end() && *it == e.v)) continue;
+            auto& av = adj[e.v];
+            auto jt = std::lower_bound(av.begin(), av.end(), e.u);
+            if (e.insert) {
+                au.insert(it, e.v); av.insert(jt, e.u);
+            } else {
+                au.erase(it); av.erase(jt);
+            }
+            uintE first = (perm[e.u] < perm[e.v]) ? e.u : e.v;
+            uintE second = (first == e.u) ? e.v : e.u;
+            if (in_mis[first]) {
+                if (e.insert) counters[second].increment(); else counters[second].decrement();
+                push(heap, second);
+            }
+        }
+        while (!heap.empty()) {
+            uintE v = heap.top(); heap.pop();
+            queued[v] = false; visited++;
+            if (!dirty(v)) continue;
+            in_mis[v] = !in_mis[v];
+            for (uintE w : adj[v]) {
+                scanned++;
+                if (perm[w] < perm[v]) continue;
+                if (in_mis[v]) counters[w].increment(); else counters[w].decrement();
+                push(heap, w);
+            }
+        }
+    }
+
+    // 在当前邻接表上按 perm 顺序从头计算的 greedy MIS (用来验证)
+    sequence<bool> from_scratch() const {
+        auto order = sequence<uintE>(n);
+        parallel_for(0, n, [&](size_t i) { order[perm[i]] = i; });
+        auto res = sequence<bool>(n, false);
+        for (uintE v : order) {
+            bool ok = true;
+            for (uintE u : adj[v]) if (res[u] && perm[u] < perm[v]) { ok = false; break; }
+            res[v] = ok;
+        }
+        return res;
+    }
+};
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
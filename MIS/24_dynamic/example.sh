@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/24_dynamic:MIS_main -c opt
+# bazel-bin/MIS/24_dynamic/MIS_main -s -b -batches 10 -batch_size 100 -verify utils/small_graph.bin
+bazel-bin/MIS/24_dynamic/MIS_main -s -b -batches 100 -batch_size 1000 /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/24_dynamic
\ No newline at end of file
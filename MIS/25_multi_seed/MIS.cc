@@ -0,0 +1,69 @@
+#include "MIS.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+template <typename T>
+void print_mis(parlay::sequence<T>& mis, std::string algo, std::string graphname) {
+    std::ofstream out("MIS/" + algo + "/output/" + graphname + ".txt");
+    int cnt = 0; for (size_t i = 0; i < mis.size(); i++) cnt += mis[i]; out << cnt;
+    for (size_t i = 0; i < mis.size(); i++) { if (mis[i]) { out << "," << i; } }
+    out.close();
+}
+
+
+namespace gbbs {
+template <class Graph>
+double MaximalIndependentSet_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: MIS" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    size_t lanes = std::min<size_t>(std::max<size_t>(P.getOptionLongValue("-lanes", 64), 1), 64);
+    uint64_t seed = P.getOptionLongValue("-seed", 1);
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+    std::cout << "### Params: -lanes = " << lanes << " -seed = " << seed << std::endl;
+
+    double tt = 0.0; timer t; t.start();
+    auto lane_mis = MaximalIndependentSet_rootset::MaximalIndependentSet(G, lanes, seed);
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "25_multi_seed", G.n, G.m, size_t(num_workers()), seed});
+    std::cout << "## Time per lane = " << tt / lanes << std::endl;
+
+    auto sizes = parlay::tabulate(lanes, [&](size_t l) {
+        return parlay::count(parlay::delayed_seq<bool>(G.n, [&](size_t v) { return (lane_mis[v] >> l) & 1; }), true);
+    });
+    std::cout << "## MIS size min = " << parlay::reduce(sizes, parlay::minm<size_t>())
+              << " avg = " << double(parlay::reduce(sizes)) / lanes
+              << " max = " << parlay::reduce(sizes, parlay::maxm<size_t>()) << std::endl;
+
+    if (P.getOption("-verify")) {
+        MaximalIndependentSet_rootset::lane_order order(seed, lanes);
+        size_t wrong = 0;
+        for (size_t l = 0; l < lanes; l++) {
+            auto expected = MaximalIndependentSet_rootset::lane_greedy(G, order, l);
+            wrong += parlay::count(parlay::delayed_seq<bool>(G.n, [&](size_t v) { return expected[v] != bool((lane_mis[v] >> l) & 1); }), true) > 0;
+        }
+        std::cout << "## Verify: " << (wrong ? "FAILED" : "OK") << " (" << lanes - wrong << "/" << lanes << " lanes match the sequential greedy)" << std::endl;
+        auto lane0 = parlay::tabulate(G.n, [&](size_t v) { return bool(lane_mis[v] & 1); });
+        print_mis(lane0, "25_multi_seed", get_graphname(P.getArgument(0)));
+    }
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::MaximalIndependentSet_runner, false);
@@ -0,0 +1,198 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+// 一次遍历同时算最多 64 个不同优先级顺序 (lane) 的 greedy MIS。
+//
+// 优先级: lane l 的 key 是 hash(v) ^ salt[l]。比较 u、w 时只看 x = hash(u) ^ hash(w) 的最高位 b:
+// 在 lane l 里 u 在 w 之前 当且仅当 salt[l] 的第 b 位等于 hash(u) 的第 b 位，
+// 所以预先算好 salt_bits[b] = {l : salt[l] 第 b 位是 1}，一条边只用一次 clz 就得到 64 个 lane 的比较结果。
+// 单看每个 lane 都是一个随机顺序，但 lane 之间不是完全独立的 (只差在 salt 的某些位上)。
+//
+// 每个点的状态是 64 位的 lane mask: in_mis / removed，以及本轮的 root_mask / removed_now。
+// 计数器按位切片 (bit-sliced): 点 v 有 bit_width(deg(v)) 个 64 位平面，第 i 个平面是 64 个计数器的第 i 位，
+// 给一组 lane 减一就是对平面做借位减法。平面按点连续存放 (vertex-major)。
+struct lane_order {
+    uint64_t salt;
+    uint64_t salt_bits[64];
+    lane_order(uint64_t seed, size_t lanes) {
+        salt = parlay::hash64(seed);
+        for (size_t b = 0; b < 64; b++) salt_bits[b] = 0;
+        for (size_t l = 0; l < lanes; l++) {
+            uint64_t s = parlay::hash64(salt ^ (l + 1));
+            for (size_t b = 0; b < 64; b++) salt_bits[b] |= ((s >> b) & 1) << l;
+        }
+    }
+    inline uint64_t key(uintE v) const { return parlay::hash64(v ^ salt); }
+    // u 排在 w 前面的 lane
+    inline uint64_t before(uintE u, uintE w) const {
+        uint64_t hu = key(u), x = hu ^ key(w);
+        if (x == 0) return (u < w) ? ~0ull : 0;
+        int b = 63 - __builtin_clzll(x);
+        return ((hu >> b) & 1) ? salt_bits[b] : ~salt_bits[b];
+    }
+    // lane l 里 v 的优先级 (用于验证)
+    inline uint64_t lane_key(uintE v, size_t l) const { return parlay::hash64(v ^ salt) ^ parlay::hash64(salt ^ (l + 1)); }
+};
+
+struct multi_state {
+    uint64_t active;                 // 参与计算的 lane
+    lane_order order;
+    sequence<size_t> offsets;        // 点 v 的平面在 planes 里的区间 [offsets[v], offsets[v + 1])
+    sequence<uint64_t> planes;
+    sequence<uint64_t> in_mis, removed, root_mask, removed_now;
+    sequence<bool> locks;
+
+    // 给 mask 里的 lane 减一，返回减到 0 的 lane
+    inline uint64_t decrement(uintE v, uint64_t mask) {
+        uint64_t* p = planes.begin() + offsets[v];
+        size_t k = offsets[v + 1] - offsets[v];
+        uint64_t borrow = mask, nz = 0;
+        for (size_t i = 0; i < k; i++) {
+            uint64_t t = p[i];
+            p[i] = t ^ borrow;
+            borrow &= ~t;
+            nz |= p[i];
+        }
+        return mask & ~nz;
+    }
+    inline void lock(uintE v) { while (__atomic_test_and_set(&locks[v], __ATOMIC_ACQUIRE)) {} }
+    inline void unlock(uintE v) { __atomic_clear(&locks[v], __ATOMIC_RELEASE); }
+    inline bool undecided(uintE v) const { return ((in_mis[v] | removed[v]) & active) != active; }
+};
+
+// roots 的邻居在 root 所在的 lane 里被删掉，返回 “本轮第一次被删” 的点
+template <class W>
+struct remove_f {
+    multi_state* S;
+    remove_f(multi_state* _S) : S(_S) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        uint64_t lanes = S->root_mask[s] & ~S->removed[d];
+        if (!lanes) return false;
+        uint64_t newly = lanes & ~__atomic_fetch_or(&S->removed[d], lanes, __ATOMIC_RELAXED);
+        if (!newly) return false;
+        return __atomic_fetch_or(&S->removed_now[d], newly, __ATOMIC_RELAXED) == 0;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        uint64_t newly = S->root_mask[s] & ~S->removed[d];
+        if (!newly) return false;
+        S->removed[d] |= newly;
+        bool first = (S->removed_now[d] == 0);
+        S->removed_now[d] |= newly;
+        return first;
+    }
+    inline bool cond(uintE d) { return S->undecided(d); }
+};
+
+// 本轮被删的点给后面的邻居减一，返回 “本轮第一次成为 root” 的点
+template <class W>
+struct decrement_f {
+    multi_state* S;
+    decrement_f(multi_state* _S) : S(_S) {}
+    inline uint64_t lanes(uintE s, uintE d) const {
+        return S->removed_now[s] & ~S->removed[d] & S->order.before(s, d);
+    }
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        uint64_t m = lanes(s, d);
+        if (!m) return false;
+        S->lock(d);
+        uint64_t zero = S->decrement(d, m);
+        S->unlock(d);
+        if (!zero) return false;
+        return __atomic_fetch_or(&S->root_mask[d], zero, __ATOMIC_RELAXED) == 0;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        uint64_t m = lanes(s, d);
+        if (!m) return false;
+        uint64_t zero = S->decrement(d, m);
+        if (!zero) return false;
+        bool first = (S->root_mask[d] == 0);
+        S->root_mask[d] |= zero;
+        return first;
+    }
+    inline bool cond(uintE d) { return S->undecided(d); }
+};
+
+
+// 返回每个点的 in_mis lane mask (第 l 位 = 该点在 lane l 的 MIS 里)
+template <class Graph>
+inline sequence<uint64_t> MaximalIndependentSet(Graph& G, size_t lanes, uint64_t seed) {
+    using W = typename Graph::weight_type;
+    size_t n = G.n;
+    multi_state S{(lanes >= 64) ? ~0ull : ((1ull << lanes) - 1), lane_order(seed, lanes)};
+
+    // 初始化计数器: 对每条边把 “邻居在前面” 的 lane 加一 (进位加法)
+    timer t1; t1.start();
+    S.offsets = parlay::tabulate(n + 1, [&](size_t i) -> size_t {
+        if (i == n) return 0;
+        size_t deg = G.get_vertex(i).out_neighbors().get_degree();
+        return deg ? 64 - __builtin_clzll(deg) : 0;
+    });
+    size_t total_planes = parlay::scan_inplace(S.offsets);
+    S.offsets[n] = total_planes;
+    S.planes = sequence<uint64_t>(total_planes, 0);
+    S.root_mask = parlay::tabulate(n, [&](size_t v) {
+        uint64_t* p = S.planes.begin() + S.offsets[v];
+        size_t k = S.offsets[v + 1] - S.offsets[v];
+        uint64_t nz = 0;
+        auto add_f = [&](uintE src, uintE ngh, const W& wgh) {
+            uint64_t carry = S.order.before(ngh, src) & S.active;
+            for (size_t i = 0; i < k && carry; i++) { uint64_t t = p[i]; p[i] = t ^ carry; carry &= t; }
+        };
+        G.get_vertex(v).out_neighbors().map(add_f, false);
+        for (size_t i = 0; i < k; i++) nz |= p[i];
+        return S.active & ~nz;
+    });
+    S.in_mis = sequence<uint64_t>(n, 0);
+    S.removed = sequence<uint64_t>(n, 0);
+    S.removed_now = sequence<uint64_t>(n, 0);
+    S.locks = sequence<bool>(n, false);
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+    std::cout << "## Counter planes = " << total_planes << " (" << total_planes * 8 << " bytes)" << std::endl;
+
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return S.root_mask[i] != 0; })
+    )));
+
+    size_t rounds = 0;
+    while (roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { S.in_mis[v] |= S.root_mask[v]; });                  // roots 在各自的 lane 里加入 MIS
+        auto removed = edgeMap(G, roots, remove_f<W>(&S), -1, sparse_blocked);              // 邻居在这些 lane 里被删掉
+        vertexMap(roots, [&](uintE v) { S.root_mask[v] = 0; });
+        auto new_roots = edgeMap(G, removed, decrement_f<W>(&S), -1, sparse_blocked);       // 按 lane 减一，减到 0 的成为新的 roots
+        vertexMap(removed, [&](uintE v) { S.removed_now[v] = 0; });
+        rounds++;
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    return std::move(S.in_mis);
+}
+
+// lane l 的串行 greedy MIS (按 lane_key 排序)，用来验证
+template <class Graph>
+inline sequence<bool> lane_greedy(Graph& G, const lane_order& order, size_t l) {
+    using W = typename Graph::weight_type;
+    size_t n = G.n;
+    auto vs = parlay::integer_sort(parlay::tabulate(n, [](size_t i) { return static_cast<uintE>(i); }),
+                                   [&](uintE v) { return order.lane_key(v, l); });
+    auto res = sequence<bool>(n, false);
+    for (uintE v : vs) {
+        bool ok = true;
+        auto f = [&](uintE src, uintE ngh, const W& wgh) { if (res[ngh] && order.before(ngh, src) >> l & 1) ok = false; };
+        G.get_vertex(v).out_neighbors().map(f, false);
+        res[v] = ok;
+    }
+    return res;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
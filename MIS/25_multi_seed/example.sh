@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/25_multi_seed:MIS_main -c opt
+# bazel-bin/MIS/25_multi_seed/MIS_main -s -b -lanes 64 -verify utils/small_graph.bin
+bazel-bin/MIS/25_multi_seed/MIS_main -s -b -lanes 64 /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/25_multi_seed
\ No newline at end of file
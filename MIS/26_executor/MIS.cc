@@ -0,0 +1,59 @@
+#include "MIS.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+template <typename T>
+void print_mis(parlay::sequence<T>& mis, std::string algo, std::string graphname) {
+    std::ofstream out("MIS/" + algo + "/output/" + graphname + ".txt");
+    int cnt = 0; for (size_t i = 0; i < mis.size(); i++) cnt += mis[i]; out << cnt;
+    for (size_t i = 0; i < mis.size(); i++) { if (mis[i]) { out << "," << i; } }
+    out.close();
+}
+
+
+namespace gbbs {
+template <class Graph>
+double MaximalIndependentSet_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: MIS" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    bool longest_path = P.getOption("-longest_path");
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+    std::cout << "### Params: -longest_path = " << longest_path << std::endl;
+#ifdef DAG_EXECUTOR_ASYNC
+    std::cout << "### Params: schedule = async" << std::endl;
+#else
+    std::cout << "### Params: schedule = rounds" << std::endl;
+#endif
+
+    double tt = 0.0; timer t; t.start();
+    auto res = MaximalIndependentSet_rootset::MaximalIndependentSet(G, longest_path);
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::metric("executor rounds", res.st.rounds);
+    telemetry::metric("executor tasks", res.st.tasks);
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "26_executor", G.n, G.m, size_t(num_workers()), 0});
+    std::cout << "## Executor rounds = " << res.st.rounds << " tasks = " << res.st.tasks << std::endl;
+    if (longest_path) std::cout << "## DAG depth = " << res.depth << std::endl;
+
+    if (P.getOption("-verify")) print_mis(res.in_mis, "26_executor", get_graphname(P.getArgument(0)));
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::MaximalIndependentSet_runner, false);
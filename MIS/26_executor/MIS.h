@@ -0,0 +1,75 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "dag_executor.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+// 用 include/dag_executor.h 跑 priority DAG 上的 greedy MIS:
+// 依赖关系直接用图本身 (v 的后继 = perm 更大的邻居，其它邻居返回 kSkip)，
+// 计数器 = perm 更小的邻居个数，task(v) 在所有更早的邻居都确定之后决定 v 是否进入 MIS。
+// 和 rootset 不同，被删掉的点也要走一遍 DAG，所以每条边都会被减一次。
+template <class Graph>
+struct later_neighbors {
+    Graph& G;
+    const uintE* perm;
+    inline size_t degree(uintE v) const { return G.get_vertex(v).out_neighbors().get_degree(); }
+    inline uintE get(uintE v, size_t i) const {
+        uintE w = std::get<0>(G.get_vertex(v).out_neighbors().get_edges()[i]);
+        return (perm[w] > perm[v]) ? w : dag_executor::kSkip;
+    }
+};
+
+struct mis_result {
+    sequence<bool> in_mis;
+    dag_executor::stats st;
+    uintE depth = 0;  // priority DAG 的最长路 (点数)，只在 longest_path 时计算
+};
+
+template <class Graph>
+inline mis_result MaximalIndependentSet(Graph& G, bool longest_path) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        return Counter(static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f)));
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    mis_result res;
+    res.in_mis = sequence<bool>(n, false);
+    later_neighbors<Graph> deps{G, perm.begin()};
+    auto task = [&](uintE v) {
+        bool ok = true;
+        auto f = [&](uintE src, uintE ngh, const W& wgh) { if (perm[ngh] < perm[src] && res.in_mis[ngh]) ok = false; };
+        G.get_vertex(v).out_neighbors().map(f, false);
+        res.in_mis[v] = ok;
+    };
+
+    if (longest_path) {
+        // dist[v] = 以 v 结尾的最长链上的点数，沿边做 write_max
+        auto dist = sequence<uintE>(n, 1);
+        auto relax = [&](uintE v, uintE w) {
+            uintE d = dist[v] + 1, cur = __atomic_load_n(&dist[w], __ATOMIC_RELAXED);
+            while (cur < d && !__atomic_compare_exchange_n(&dist[w], &cur, d, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+        };
+        res.st = dag_executor::run(n, deps, counters.begin(), task, relax);
+        res.depth = parlay::reduce(dist, parlay::maxm<uintE>());
+    } else {
+        res.st = dag_executor::run(n, deps, counters.begin(), task);
+    }
+    return res;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
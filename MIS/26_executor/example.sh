@@ -0,0 +1,6 @@
+cd ../..
+bazel build //MIS/26_executor:MIS_main //MIS/26_executor:MIS_async_main -c opt
+# bazel-bin/MIS/26_executor/MIS_main -s -b utils/small_graph.bin
+bazel-bin/MIS/26_executor/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+# bazel-bin/MIS/26_executor/MIS_async_main -s -b -longest_path /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/26_executor
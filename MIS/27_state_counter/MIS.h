@@ -0,0 +1,81 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "state_counter.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+// 计数器和点的状态放在同一个字里 (见 include/state_counter.h):
+// 删除是一次 fetch_or，减一是一次 fetch_sub，返回的旧值直接说明结果，
+// 不再有 “先读 not_zero 再 exchange / 减一” 的两步操作。
+// cond 仍然保留一次普通读: edgeMap 的 dense 模式靠它跳过已经确定的点。
+template <class W>
+struct remove_f {
+    StateCounter* counters;
+    remove_f(StateCounter* _counters) : counters(_counters) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return counters[d].remove_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return counters[d].remove(); }
+    inline bool cond(uintE d) { return counters[d].undecided(); }
+};
+
+template <class W>
+struct mis_f {
+    StateCounter* counters;
+    uintE* perm;
+    mis_f(StateCounter* _counters, uintE* _perm) : counters(_counters), perm(_perm) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic() == StateCounter::result::zero; }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (perm[s] < perm[d]) { return counters[d].decrement() == StateCounter::result::zero; }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].undecided(); }
+};
+
+
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<StateCounter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return StateCounter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return counters[i].is_zero(); })
+    )));
+
+    // parallel MIS
+    auto in_mis = sequence<bool>(n, false);
+    size_t rounds = 0, finished = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
+        auto removed = neighbor_map(G, roots, remove_f<W>(counters.begin()));             // roots 的邻居置 removed 位，返回第一次被删的点
+        auto new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/27_state_counter:MIS_main -c opt
+# bazel-bin/MIS/27_state_counter/MIS_main -s -b utils/small_graph.bin
+bazel-bin/MIS/27_state_counter/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/27_state_counter
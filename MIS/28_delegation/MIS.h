@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+// Owner-computes: 点号区间静态地分给 owners 个 owner，计数器只由它的 owner 修改，全部是非原子操作。
+//
+// 每一步 (删除 roots 的邻居 / 给 removed 的后继减一) 分两个阶段:
+//   1. 生产: frontier 的边按度数前缀和切成 blocks 段并行扫描，目标点 d 追加到 buf[block][owner(d)]
+//      (切分点可以落在一个点的邻接表中间，高度数点的边分给好几个块；
+//       每个缓冲区只有一个生产者和一个消费者，跨轮复用容量)
+//   2. 消费: 每个 owner 按块顺序取出发给自己的目标，做 set_zero() / decrement()，
+//      在本地收集新被删的点 / 新的 roots
+// 两个阶段之间是 parallel_for 的汇合点。没有用真正的 SPSC 环形队列边生产边消费:
+// parlay 是 fork-join + work stealing，worker 不能假设另一个任务同时在跑，
+// 消费者自旋等待还没被调度的生产者会死锁。
+//
+// 生产阶段只读计数器 (cond 的过滤)，消费阶段只有 owner 写，所以不需要原子操作。
+struct router {
+    size_t n, owners, chunk, blocks;
+    std::vector<std::vector<uintE>> buf;   // buf[b * owners + o]
+    std::vector<std::vector<uintE>> out;   // 每个 owner 的输出
+    sequence<size_t> received;             // 每个 owner 累计收到的目标数
+
+    router(size_t _n, size_t _owners)
+        : n(_n), owners(std::max<size_t>(1, std::min(_owners, std::max<size_t>(_n, 1)))),
+          chunk((_n + owners - 1) / owners), blocks(4 * owners), buf(blocks * owners), out(owners), received(owners, 0) {}
+
+    inline size_t owner(uintE v) const { return v / chunk; }
+
+    // targets(v, lo, hi, emit): 对 frontier 中的点 v 的第 [lo, hi) 条边，把要处理的目标点交给 emit
+    // apply(d): owner 处理目标 d，返回 d 是否进入输出
+    template <class Graph, class Targets, class Apply>
+    sequence<uintE> run(Graph& G, const sequence<uintE>& frontier, Targets targets, Apply apply) {
+        size_t k = frontier.size();
+        if (k == 0) return sequence<uintE>();
+        // 按度数前缀和切块，使每块的边数大致相同。点 i 占 [degs[i], degs[i + 1]) 这些位置:
+        // 第一个位置是点本身 (度数为 0 的点也算一点工作量)，后面依次是它的边
+        auto degs = parlay::tabulate(k + 1, [&](size_t i) -> size_t {
+            return (i == k) ? 0 : G.get_vertex(frontier[i]).out_neighbors().get_degree() + 1;
+        });
+        size_t total = parlay::scan_inplace(degs);
+        degs[k] = total;
+        size_t nb = std::min(blocks, total);
+        parallel_for(0, nb, [&](size_t b) {
+            size_t s = total * b / nb, e = total * (b + 1) / nb;
+            size_t i = std::upper_bound(degs.begin(), degs.begin() + k, s) - degs.begin() - 1;  // 包含位置 s 的点
+            auto* row = &buf[b * owners];
+            for (; i < k && degs[i] < e; i++) {
+                size_t lo = std::max(s, degs[i] + 1) - degs[i] - 1;
+                size_t hi = std::min(e, degs[i + 1]) - degs[i] - 1;
+                if (lo < hi) targets(frontier[i], lo, hi, [&](uintE d) { row[owner(d)].push_back(d); });
+            }
+        }, 1);
+        parallel_for(0, owners, [&](size_t o) {
+            auto& res = out[o];
+            res.clear();
+            for (size_t b = 0; b < nb; b++) {
+                auto& in = buf[b * owners + o];
+                for (uintE d : in) if (apply(d)) res.push_back(d);
+                received[o] += in.size();
+                in.clear();
+            }
+        }, 1);
+        return parlay::flatten(parlay::map(out, [](const auto& r) { return sequence<uintE>(r.begin(), r.end()); }));
+    }
+};
+
+
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, size_t owners) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    );
+
+    router R(n, owners);
+    std::cout << "## Owners = " << R.owners << " blocks = " << R.blocks << std::endl;
+    auto in_mis = sequence<bool>(n, false);
+    size_t rounds = 0, finished = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        parallel_for(0, roots.size(), [&](size_t i) { in_mis[roots[i]] = true; });      // roots加入MIS
+        // roots 的邻居发给 owner 清零，返回第一次被清零的点
+        auto removed = R.run(G, roots,
+            [&](uintE v, size_t lo, size_t hi, auto emit) {
+                auto nghs = G.get_vertex(v).out_neighbors();
+                for (size_t j = lo; j < hi; j++) {
+                    uintE ngh = nghs.get_neighbor(j);
+                    if (counters[ngh].not_zero()) emit(ngh);
+                }
+            },
+            [&](uintE d) { return counters[d].set_zero(); });
+        // removed 的后继发给 owner 减一，减到 0 的成为新的 roots
+        auto new_roots = R.run(G, removed,
+            [&](uintE v, size_t lo, size_t hi, auto emit) {
+                uintE pv = perm[v];
+                auto nghs = G.get_vertex(v).out_neighbors();
+                for (size_t j = lo; j < hi; j++) {
+                    uintE ngh = nghs.get_neighbor(j);
+                    if (pv < perm[ngh] && counters[ngh].not_zero()) emit(ngh);
+                }
+            },
+            [&](uintE d) { return counters[d].decrement(); });
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) {
+            auto deg = [&](const sequence<uintE>& vs) {
+                return parlay::reduce(parlay::delayed_seq<size_t>(vs.size(), [&](size_t i) { return G.get_vertex(vs[i]).out_neighbors().get_degree(); }));
+            };
+            telemetry::round(roots.size(), removed.size(), telemetry::untimed([&] { return deg(roots) + deg(removed); }), rt);
+        }
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    // owner 之间收到的目标数差别大说明点号区间的划分不均衡
+    std::cout << "## Routed targets = " << parlay::reduce(R.received)
+              << " max per owner = " << parlay::reduce(R.received, parlay::maxm<size_t>()) << std::endl;
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/28_delegation:MIS_main -c opt
+# bazel-bin/MIS/28_delegation/MIS_main -s -b -owners 4 utils/small_graph.bin
+bazel-bin/MIS/28_delegation/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/28_delegation
@@ -0,0 +1,134 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+template <class P, class W>
+struct GetNghs {
+    P& p;
+    GetNghs(P& p) : p(p) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return p[d].set_zero_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return p[d].set_zero(); }
+    inline bool cond(uintE d) { return p[d].not_zero(); }
+};
+
+template <class W>
+struct mis_f {
+    Counter* counters;
+    uintE* perm;
+    mis_f(Counter* _counters, uintE* _perm) : counters(_counters), perm(_perm) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (perm[s] < perm[d]) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+};
+
+// Propagation blocking (PageRank 里的做法) 的减一阶段:
+//   1. 分箱: removed 的每条有效边 (s, d) 把 d 放进第 d >> bits 个箱子。每个点先把有效的目标紧凑地写到
+//      自己那一段的开头，按有效个数的前缀和拷成一个紧凑数组，再用 integer_sort 按箱号排序
+//   2. 应用: 每个箱子对应计数器数组里连续的 2^bits 个计数器 (默认 2^16 * 4B = 256KB，放得进 L2)，
+//      一个箱子由一个任务顺序处理，不需要原子操作；减到 0 的点就是新的 roots
+// 只在 removed 的边数超过 threshold * m 的轮次使用，其它轮次照常用 edgeMap。
+template <class Graph>
+inline sequence<uintE> blocked_decrement(Graph& G, vertexSubset& removed, Counter* counters, const uintE* perm, size_t bits) {
+    using W = typename Graph::weight_type;
+    removed.toSparse();
+    size_t k = removed.size();
+    auto offsets = parlay::tabulate(k + 1, [&](size_t i) -> size_t {
+        return (i == k) ? 0 : G.get_vertex(removed.vtx(i)).out_neighbors().get_degree();
+    });
+    size_t total = parlay::scan_inplace(offsets);
+    offsets[k] = total;
+    auto targets = sequence<uintE>::uninitialized(total);
+    auto valid = sequence<size_t>(k + 1, 0);
+    parallel_for(0, k, [&](size_t i) {
+        uintE v = removed.vtx(i);
+        uintE* out = targets.begin() + offsets[i];
+        size_t j = 0;
+        auto f = [&](uintE src, uintE ngh, const W& wgh) {
+            if (perm[src] < perm[ngh] && counters[ngh].not_zero()) out[j++] = ngh;
+        };
+        G.get_vertex(v).out_neighbors().map(f, false);
+        valid[i] = j;
+    }, 1);
+    size_t packed_size = parlay::scan_inplace(valid);
+    valid[k] = packed_size;
+    auto packed = sequence<uintE>::uninitialized(packed_size);
+    parallel_for(0, k, [&](size_t i) {
+        std::copy(targets.begin() + offsets[i], targets.begin() + offsets[i] + (valid[i + 1] - valid[i]), packed.begin() + valid[i]);
+    }, 1);
+
+    size_t bins = (G.n >> bits) + 1;
+    auto bin_of = [&](uintE d) -> size_t { return d >> bits; };
+    auto sorted = parlay::integer_sort(packed, bin_of);
+    auto starts = parlay::tabulate(bins + 1, [&](size_t b) {
+        return static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), b,
+                                   [&](uintE d, size_t key) { return bin_of(d) < key; }) - sorted.begin());
+    });
+    auto fired = sequence<bool>(sorted.size(), false);
+    parallel_for(0, bins, [&](size_t b) {
+        for (size_t i = starts[b]; i < starts[b + 1]; i++) fired[i] = counters[sorted[i]].decrement();
+    }, 1);
+    return parlay::pack(sorted, fired);
+}
+
+
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, double threshold, size_t bits) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    // parallel MIS
+    auto in_mis = sequence<bool>(n, false);
+    size_t rounds = 0, finished = 0, blocked_rounds = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
+        auto removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
+        size_t removed_edges = telemetry::degree_sum(G, removed);
+        vertexSubset new_roots(n);
+        if (removed_edges > threshold * G.m) {          // 边多的轮次: propagation blocking
+            new_roots = vertexSubset(n, blocked_decrement(G, removed, counters.begin(), perm.begin(), bits));
+            blocked_rounds++;
+        } else {
+            new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+        }
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + removed_edges, rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    std::cout << "## Blocked rounds = " << blocked_rounds << " / " << rounds << std::endl;
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
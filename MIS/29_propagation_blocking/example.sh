@@ -0,0 +1,6 @@
+cd ../..
+bazel build //MIS/29_propagation_blocking:MIS_main -c opt
+# bazel-bin/MIS/29_propagation_blocking/MIS_main -s -b -pb_threshold 0 utils/small_graph.bin
+bazel-bin/MIS/29_propagation_blocking/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/uk-2002_sym.bin
+bazel-bin/MIS/29_propagation_blocking/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/sd_arc_sym.bin
+cd MIS/29_propagation_blocking
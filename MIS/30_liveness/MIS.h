@@ -0,0 +1,123 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "liveness_bitmap.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+// cond 先查 liveness bitmap (见 include/liveness_bitmap.h)，死掉的点不再读计数器；
+// Count 为 true 时被过滤掉的边数记在 tally 里，每轮汇总一次
+// (只在 -count_filtered 时打开，默认的计时路径里没有这次 worker_id() 和写)。
+// neighbor_map 阶段 bit 为 1 的点计数器一定大于 0 (roots 的 bit 已经在 vertexMap 里清掉)，
+// 所以这里只查 bit。
+template <class P, class W, bool Count>
+struct GetNghs {
+    P& p;
+    LivenessBitmap& live;
+    FilterTally& tally;
+    GetNghs(P& p, LivenessBitmap& live, FilterTally& tally) : p(p), live(live), tally(tally) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (!p[d].set_zero_atomic()) return false;
+        live.kill(d);
+        return true;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (!p[d].set_zero()) return false;
+        live.kill(d);
+        return true;
+    }
+    inline bool cond(uintE d) {
+        if (live.live(d)) return true;
+        if constexpr (Count) tally.add();
+        return false;
+    }
+};
+
+// 本轮刚减到 0 的点 bit 还是 1 (下一轮 vertexMap 才清)，所以 bit 为 1 时仍要看计数器
+template <class W, bool Count>
+struct mis_f {
+    Counter* counters;
+    uintE* perm;
+    LivenessBitmap& live;
+    FilterTally& tally;
+    mis_f(Counter* _counters, uintE* _perm, LivenessBitmap& _live, FilterTally& _tally)
+        : counters(_counters), perm(_perm), live(_live), tally(_tally) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (perm[s] < perm[d]) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) {
+        if (!live.live(d)) {
+            if constexpr (Count) tally.add();
+            return false;
+        }
+        return counters[d].not_zero();
+    }
+};
+
+
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, bool count_filtered = false) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    auto live = LivenessBitmap::from(n, [&](size_t i) { return counters[i].not_zero(); }); // roots 一开始就不是 live
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    std::cout << "## Liveness bitmap = " << live.bytes() << " bytes, counters = " << n * sizeof(Counter) << " bytes" << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    // parallel MIS
+    auto in_mis = sequence<bool>(n, false);
+    FilterTally tally;
+    size_t rounds = 0, finished = 0, filtered_total = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; live.kill(v); });                                  // roots加入MIS
+        auto removed = count_filtered                                                                        // 获得 roots 的邻居，并把这些邻居的计数器清零
+            ? neighbor_map(G, roots, GetNghs<decltype(counters), W, true>(counters, live, tally))
+            : neighbor_map(G, roots, GetNghs<decltype(counters), W, false>(counters, live, tally));
+        auto new_roots = count_filtered                                                                      // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+            ? edgeMap(G, removed, mis_f<W, true>(counters.begin(), perm.begin(), live, tally), -1, sparse_blocked)
+            : edgeMap(G, removed, mis_f<W, false>(counters.begin(), perm.begin(), live, tally), -1, sparse_blocked);
+        rounds++; finished += (roots.size() + removed.size());
+        double rt = nr.stop();
+        if (telemetry::enabled()) telemetry::round(roots.size(), removed.size(), telemetry::edges(G, roots) + telemetry::edges(G, removed), rt);
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+        if (count_filtered) {
+            size_t filtered = tally.take();
+            filtered_total += filtered;
+            std::cout << "## Filtered round = " << rounds << " counter accesses avoided = " << filtered << "\n";
+        }
+    }
+    if (count_filtered) {
+        std::cout << "## Filtered total = " << filtered_total << std::endl;
+        telemetry::metric("counter accesses avoided", filtered_total);
+    }
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
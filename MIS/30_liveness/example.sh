@@ -0,0 +1,6 @@
+cd ../..
+bazel build //MIS/30_liveness:MIS_main -c opt
+# bazel-bin/MIS/30_liveness/MIS_main -s -b utils/small_graph.bin
+# bazel-bin/MIS/30_liveness/MIS_main -s -b -count_filtered utils/small_graph.bin    # 统计过滤掉的计数器访问 (计时不可比)
+bazel-bin/MIS/30_liveness/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/30_liveness
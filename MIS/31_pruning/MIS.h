@@ -0,0 +1,182 @@
+#pragma once
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalIndependentSet_rootset {
+
+template <class P, class W>
+struct GetNghs {
+    P& p;
+    GetNghs(P& p) : p(p) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) { return p[d].set_zero_atomic(); }
+    inline bool update(const uintE& s, const uintE& d, const W& w) { return p[d].set_zero(); }
+    inline bool cond(uintE d) { return p[d].not_zero(); }
+};
+
+template <class W>
+struct mis_f {
+    Counter* counters;
+    uintE* perm;
+    mis_f(Counter* _counters, uintE* _perm) : counters(_counters), perm(_perm) {}
+    inline bool updateAtomic(const uintE& s, const uintE& d, const W& wgh) {
+        if (perm[s] < perm[d]) { return counters[d].decrement_atomic(); }
+        return false;
+    }
+    inline bool update(const uintE& s, const uintE& d, const W& w) {
+        if (perm[s] < perm[d]) { return counters[d].decrement(); }
+        return false;
+    }
+    inline bool cond(uintE d) { return counters[d].not_zero(); }
+};
+
+// 只保留 live 点之间的边的 CSR (shadow)：live 点的邻接表按原顺序压缩，死点的邻接表为空。
+// 原图不动 (可能是 mmap 进来的)，剪枝之后的轮次都在 shadow 上遍历。
+struct shadow_csr {
+    sequence<size_t> offsets;   // n + 1
+    sequence<uintE> edges;
+    inline size_t degree(uintE v) const { return offsets[v + 1] - offsets[v]; }
+    inline size_t m() const { return edges.size(); }
+};
+
+// for_each(v, f) 顺序枚举 v 的邻居 (原图或上一次的 shadow)，live 在压缩期间不变
+template <class ForEach, class Live>
+inline shadow_csr compact(size_t n, ForEach for_each, Live& live) {
+    shadow_csr s;
+    s.offsets = parlay::tabulate(n + 1, [&](size_t v) -> size_t {
+        if (v == n || !live[v]) return 0;
+        size_t d = 0;
+        for_each(v, [&](uintE u) { d += live[u]; });
+        return d;
+    });
+    size_t m = parlay::scan_inplace(s.offsets);
+    s.edges = sequence<uintE>::uninitialized(m);
+    parallel_for(0, n, [&](size_t v) {
+        if (!live[v]) return;
+        uintE* out = s.edges.begin() + s.offsets[v];
+        size_t j = 0;
+        for_each(v, [&](uintE u) { if (live[u]) out[j++] = u; });
+    });
+    return s;
+}
+
+// frontier 在 shadow 上的度数之和
+inline size_t degrees(const shadow_csr& s, vertexSubset& vs) {
+    if (vs.size() == 0) return 0;
+    vs.toSparse();
+    return parlay::reduce(parlay::delayed_seq<size_t>(vs.size(), [&](size_t i) { return s.degree(vs.vtx(i)); }));
+}
+
+// 并行展开 frontier 在 shadow 上的邻接表，返回 f(s, d) 为 true 的 d (f 需要是原子的)
+template <class F>
+inline vertexSubset expand(size_t n, const shadow_csr& s, vertexSubset& vs, F f) {
+    if (vs.size() == 0) return vertexSubset(n);
+    vs.toSparse();
+    size_t k = vs.size();
+    auto offs = parlay::tabulate(k + 1, [&](size_t i) -> size_t { return (i == k) ? 0 : s.degree(vs.vtx(i)); });
+    size_t total = parlay::scan_inplace(offs);
+    auto out = sequence<uintE>::uninitialized(total);
+    parallel_for(0, k, [&](size_t i) {
+        uintE v = vs.vtx(i);
+        const uintE* nghs = s.edges.begin() + s.offsets[v];
+        for (size_t j = 0; j < s.degree(v); j++) out[offs[i] + j] = f(v, nghs[j]) ? nghs[j] : UINT_E_MAX;
+    }, 1);
+    return vertexSubset(n, parlay::filter(out, [](uintE d) { return d != UINT_E_MAX; }));
+}
+
+
+// 按对称图估计: 本轮死掉的点 (roots + removed) 在当前结构里的度数之和，就是新变成 "指向死点" 的边数。
+// 自上次压缩以来累计的死边超过 threshold * (当前边数) 时，在轮末重建 shadow CSR。
+// threshold >= 1 时不剪枝 (和 05 一样)。
+template <class Graph>
+inline sequence<bool> MaximalIndependentSet(Graph& G, double threshold) {
+    using W = typename Graph::weight_type;
+
+    // 初始化计数器
+    timer t1; t1.start();
+    size_t n = G.n;
+    auto perm = parlay::random_permutation<uintE>(n);
+    auto counters = parlay::tabulate<Counter>(n, [&](size_t i){
+        uintE our_pri = perm[i];
+        auto count_f = [&](uintE src, uintE ngh, const W& wgh) { return perm[ngh] < our_pri;};
+        int cnt = static_cast<int>(G.get_vertex(i).out_neighbors().count(count_f));
+        return Counter(cnt);
+    });
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化frontier(rootset): counter为0的点
+    auto roots = vertexSubset(n, std::move(parlay::pack_index<uintE>(
+        parlay::delayed_seq<bool>(n, [&](size_t i) { return !counters[i].not_zero(); })
+    )));
+
+    // parallel MIS
+    auto in_mis = sequence<bool>(n, false);
+    shadow_csr shadow;
+    bool pruned = false;
+    size_t cur_m = G.m, dead = 0, prunes = 0;
+    size_t traversed = 0, unpruned = 0;        // 实际遍历的边数 / 不剪枝时会遍历的边数 (只在 -json 时统计)
+    size_t rounds = 0, finished = 0;
+    while (finished != n && roots.size() > 0) {
+        timer nr; nr.start();
+        vertexMap(roots, [&](uintE v) { in_mis[v] = true; });                            // roots加入MIS
+        vertexSubset removed(n), new_roots(n);
+        size_t round_edges = 0;                                                          // 本轮遍历的边数，剪枝判断要用时才在计时区间内算
+        if (!pruned) {
+            removed = neighbor_map(G, roots, GetNghs<decltype(counters), W>(counters)); // 获得 roots 的邻居，并把这些邻居的计数器清零
+            new_roots = edgeMap(G, removed, mis_f<W>(counters.begin(), perm.begin()), -1, sparse_blocked); // 对 removed 的邻居做 “计数器减一”，减到 0 的成为新的 roots
+            if (threshold < 1) round_edges = telemetry::degree_sum(G, roots) + telemetry::degree_sum(G, removed);
+        } else {
+            removed = expand(n, shadow, roots, [&](uintE s, uintE d) {
+                return counters[d].not_zero() && counters[d].set_zero_atomic();
+            });
+            new_roots = expand(n, shadow, removed, [&](uintE s, uintE d) {
+                return perm[s] < perm[d] && counters[d].not_zero() && counters[d].decrement_atomic();
+            });
+            round_edges = degrees(shadow, roots) + degrees(shadow, removed);
+        }
+        rounds++; finished += (roots.size() + removed.size());
+        dead += round_edges;
+        if (threshold < 1 && finished != n && dead > threshold * cur_m) {
+            timer tc; tc.start();
+            auto live = parlay::tabulate<bool>(n, [&](size_t v) { return counters[v].not_zero(); });
+            vertexMap(new_roots, [&](uintE v) { live[v] = true; });                     // 下一轮的 roots 还要遍历邻居
+            size_t old_m = cur_m;
+            if (!pruned) {
+                shadow = compact(n, [&](size_t v, auto f) {
+                    G.get_vertex(v).out_neighbors().map([&](uintE src, uintE ngh, const W& w) { f(ngh); }, false);
+                }, live);
+            } else {
+                shadow = compact(n, [&](size_t v, auto f) {
+                    for (size_t i = shadow.offsets[v]; i < shadow.offsets[v + 1]; i++) f(shadow.edges[i]);
+                }, live);
+            }
+            pruned = true; prunes++;
+            cur_m = shadow.m(); dead = 0;
+            std::cout << "## Prune round = " << rounds << " edges = " << old_m << " -> " << cur_m << " time = " << tc.stop() << "\n";
+        }
+        double rt = nr.stop();
+        if (telemetry::enabled()) {            // 遍历边数只在 -json 时统计，额外的度数求和用 telemetry::edges，不计入运行时间
+            if (threshold >= 1) round_edges = telemetry::edges(G, roots) + telemetry::edges(G, removed);
+            traversed += round_edges;
+            unpruned += pruned ? telemetry::edges(G, roots) + telemetry::edges(G, removed) : round_edges;
+            telemetry::round(roots.size(), removed.size(), round_edges, rt);
+        }
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    std::cout << "## Prunes = " << prunes << std::endl;
+    if (telemetry::enabled()) {
+        std::cout << "## Edges traversed total = " << traversed << std::endl;
+        std::cout << "## Edges traversed without pruning = " << unpruned << std::endl;
+        telemetry::metric("edges traversed", traversed);
+        telemetry::metric("edges traversed without pruning", unpruned);
+    }
+    return in_mis;
+}
+
+
+}  // namespace MaximalIndependentSet_rootset
+}  // namespace gbbs
@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MIS/31_pruning:MIS_main -c opt
+# bazel-bin/MIS/31_pruning/MIS_main -s -b -prune_threshold 0.1 utils/small_graph.bin
+bazel-bin/MIS/31_pruning/MIS_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MIS/31_pruning
@@ -0,0 +1,47 @@
+import os
+import sys
+import json
+import glob
+
+# 比较两组 telemetry 记录 (run.py 写的 <algo>/telemetry/*.json)，找出变慢的图
+# 用法: python3 compare.py <baseline> <candidate> [threshold]
+#   baseline / candidate: 算法目录 (如 05_deterministic) 或保存下来的 telemetry 目录 (比较不同 commit)
+#   threshold: 中位数变慢超过这个比例才算 (默认 0.05)
+# 只有中位数变慢超过 threshold，并且两边的 95% 置信区间不重叠时才标记为 REGRESSION；
+# 有回退时返回值为 1，方便放进脚本里。
+
+def load_dir(path):
+    if os.path.isdir(os.path.join(path, "telemetry")):
+        path = os.path.join(path, "telemetry")
+    records = {}
+    for fn in sorted(glob.glob(os.path.join(path, "*.json"))):
+        with open(fn, encoding='utf-8') as f:
+            rec = json.load(f)
+        records[rec["graph"]] = rec
+    return records
+
+def interval(rec):
+    t = rec["summary"]["time"]
+    return t["median"], t["mean"] - t["ci95"], t["mean"] + t["ci95"]
+
+if __name__ == "__main__":
+    base = load_dir(sys.argv[1])
+    cand = load_dir(sys.argv[2])
+    threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 0.05
+    regressions = 0
+    print("%-24s %12s %12s %9s  %s" % ("graph", "baseline", "candidate", "change", ""))
+    for graph in sorted(set(base) & set(cand)):
+        b_med, b_lo, b_hi = interval(base[graph])
+        c_med, c_lo, c_hi = interval(cand[graph])
+        change = (c_med - b_med) / b_med if b_med > 0 else 0.0
+        tag = ""
+        if change > threshold and c_lo > b_hi:
+            tag = "REGRESSION"
+            regressions += 1
+        elif change < -threshold and c_hi < b_lo:
+            tag = "improvement"
+        print("%-24s %12.6f %12.6f %+8.1f%%  %s" % (graph, b_med, c_med, 100 * change, tag))
+    for graph in sorted(set(base) ^ set(cand)):
+        print("%-24s only in %s" % (graph, sys.argv[1] if graph in base else sys.argv[2]))
+    print("%d regression(s)" % regressions)
+    sys.exit(1 if regressions else 0)
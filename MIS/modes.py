@@ -0,0 +1,60 @@
+import os
+import re
+import sys
+import csv
+import subprocess
+from config import *
+from run import execute_live, load_telemetry
+
+# 同一个算法在某个参数的不同取值下的对比表
+# 用法: python3 modes.py <algo> <flag> <value1> <value2> ...
+# 例如: python3 modes.py 17_prefetch -prefetch 0 4 8 16 32
+# 结果写到 <algo>/benchmark_<flag>.csv, 每个取值一列运行时间, 一列计数器初始化时间, 一列轮数,
+# 程序输出了 "## Total decrements" / "## MIS size" 时再各加一列，
+# -json 记录里有 "edges traversed" / "edges traversed without pruning" 指标 (31_pruning) 时也各加一列 (没有的留空)
+# 和 run.py 一样在进程内重复 RUN_REPEAT 次 (外加 1 次预热)，时间取 -json 记录里去掉预热后的中位数，
+# 轮数和附加列取最后一次运行
+# 环境变量 MODES_ARGS: 每次运行都额外带上的参数 (空格分隔)，例如 MODES_ARGS=-count_decs
+
+def parse_extra(text):
+    text = text.split("### Application:")[-1]
+    m_dec = re.search(r"## Total decrements\s*=\s*(\d+)", text)
+    m_size = re.search(r"## MIS size\s*=\s*(\d+)", text)
+    return (int(m_dec.group(1)) if m_dec else "", int(m_size.group(1)) if m_size else "")
+
+def metrics(rec, names):
+    last = rec["runs"][-1]["metrics"] if rec["runs"] else {}
+    return tuple(int(last[name]) if name in last else "" for name in names)
+
+if __name__ == "__main__":
+    algo = str(sys.argv[1])
+    flag = str(sys.argv[2])
+    values = [str(v) for v in sys.argv[3:]]
+    repeat = int(os.environ.get("RUN_REPEAT", "5"))
+    extra = os.environ.get("MODES_ARGS", "").split()
+    execute_live(["mkdir", "-p", "telemetry"], algo)
+    execute_live(["bazel", "build", "//MIS/" + algo + ":MIS_main", "-c", "opt"], "..")
+    columns = ["Running Time", "Counter Initialization Time", "rounds", "Total decrements", "MIS size", "Edges traversed",
+               "Edges traversed without pruning"]
+    with open(algo + "/benchmark_" + flag.lstrip("-") + ".csv", 'w', newline='', encoding='utf-8') as f:
+        writer = csv.writer(f)
+        writer.writerow(["graph name"] + [c + " (" + flag + " " + v + ")" for c in columns for v in values])
+        for graph in graphs:
+            results = []
+            for v in values:
+                json_path = "MIS/" + algo + "/telemetry/" + graph + "_" + flag.lstrip("-") + "_" + v + ".json"
+                command = ["bazel-bin/MIS/" + algo + "/MIS_main", "-s", "-b", "-rounds", str(repeat + 1), "-json", json_path,
+                           flag, v] + extra + [GRAPH_PATH + graph + ".bin"]
+                print(" ".join(command))
+                result = subprocess.run(command, cwd="..", stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                                        universal_newlines=True)
+                if result.stderr:
+                    print(result.stderr)
+                rec = load_telemetry("../" + json_path)
+                rounds = len(rec["runs"][-1]["rounds"]) if rec["runs"] else 0
+                results.append((rec["summary"]["time"]["median"], rec["summary"]["init"]["median"], rounds)
+                               + parse_extra(result.stdout)
+                               + metrics(rec, ["edges traversed", "edges traversed without pruning"]))
+            row = [graph] + [r[c] for c in range(len(columns)) for r in results]
+            print(row)
+            writer.writerow(row)
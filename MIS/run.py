@@ -1,40 +1,24 @@
-import re
+import os
 import sys
+import json
 import csv
 import subprocess
-import numpy as np
 from config import *
 
-def parse_output(text):
-    blocks = text.split("### Application:")
-    parsed = []
+def load_telemetry(path):
+    with open(path, encoding='utf-8') as f:
+        return json.load(f)
 
-    for blk in blocks:
-        blk = blk.strip()
-        if not blk:
-            continue
-
-        # Running Time（必须有，否则跳过该块）
-        m_rt = re.search(r"### Running Time:\s*([0-9.eE+-]+)", blk)
-        if not m_rt:
-            continue
-        running_time = float(m_rt.group(1))
-
-        # Counter initialization time（可选）
-        m_init = re.search(r"## Counter initialization time\s*=\s*([0-9.eE+-]+)", blk)
-        counter_init = [float(m_init.group(1))] if m_init else []
-        m_init = re.search(r"## Counter initialization time2\s*=\s*([0-9.eE+-]+)", blk)
-        if m_init:
-            counter_init += [float(m_init.group(1))]
-
-        # 各 round（可选）
-        round_times = re.findall(r"## round\s*=\s*\d+\s*time\s*=\s*([0-9.eE+-]+)", blk)
-        rounds = [float(r) for r in round_times] if round_times else []
-
-        entry = [running_time] + counter_init + rounds
-        parsed.append(entry)
-
-    return parsed
+# 一行 benchmark.csv: 时间的中位数 / 最小值 / 95% 置信区间半宽，初始化时间中位数，
+# 以及最后一次运行的轮数和扫描的边数 (确定性版本每次都一样)。
+# 没有按轮记录的版本 (例如 26_executor 的 async 调度) 这两列留空
+def summary_row(rec):
+    last = rec["runs"][-1]["rounds"] if rec["runs"] else []
+    rounds = len(last) if last else ""
+    edges = sum(r[2] for r in last) if last else ""
+    s = rec["summary"]
+    return [s["time"]["median"], s["time"]["min"], s["time"]["ci95"], s["init"]["median"],
+            rounds, edges, rec["repetitions"] - rec["warmup"]]
 
 def execute(command, cwd=""):
     print(" ".join(command))
@@ -43,13 +27,10 @@ def execute(command, cwd=""):
         stdout=subprocess.PIPE, stderr=subprocess.PIPE,
         universal_newlines=True
     )
-    stdout = result.stdout
-    print(stdout)
+    print(result.stdout)
     if result.stderr:
         print(result.stderr)
 
-    return parse_output(stdout)
-
 def execute_seq(command, cwd=""):
     print(" ".join(command))
     result = subprocess.run(
@@ -62,50 +43,52 @@ def execute_seq(command, cwd=""):
     if result.stderr:
         print(result.stderr)
 
-    return float(stdout)
+    # 最后一行是平均运行时间，其余是 "## ..." 形式的附加信息
+    lines = stdout.strip().splitlines()
+    running_time = float(lines[-1])
+    load = [l for l in lines if l.startswith("## Graph load time")]
+    load_time = float(load[0].split("=")[1]) if load else 0.0
+    return [running_time, load_time]
 
 def execute_live(command, cwd=""):
     print(" ".join(command))
     process = subprocess.Popen(command, cwd=cwd)
     process.wait()
 
-def pad_times_with_zeros(times):
-    max_len = max(len(row) for row in times)
-    for i in range(len(times)):
-        if len(times[i]) < max_len:
-            times[i] += [0.0] * (max_len - len(times[i]))
-
 if __name__ == "__main__":
     algo = str(sys.argv[1])
     record = str(sys.argv[2])
+    # 可选的第三个参数: snapshot 缓存目录 (-cache，相对仓库根目录)。只有第一次运行是 cold，它是预热运行，不计入统计
+    cache = ["-cache", sys.argv[3]] if len(sys.argv) > 3 else []
+    if cache:
+        execute_live(["mkdir", "-p", sys.argv[3]], "..")
     execute_live(["mkdir", "-p", "output"], algo)
     #graphs = ["HepPh_sym"]
     #graphs = ["friendster_sym"]
-    if algo == "01_sequential" or algo == "02_sequential_dag":
+    if algo.split("_", 1)[1].startswith("sequential"):
         execute_live(["make"], algo)
         with open(algo + "/benchmark.csv", 'w', newline='', encoding='utf-8') as f:
             writer = csv.writer(f)
-            writer.writerow(["graph name", "Running Time"])
+            writer.writerow(["graph name", "Running Time", "Load Time"])
             for graph in graphs:
                 times = execute_seq(["./MIS", GRAPH_PATH + graph + ".bin", record], algo)
-                row = [graph, times]
+                row = [graph] + times
                 print(row)
                 writer.writerow(row)
     else:
+        # 并行版本: 程序自己在进程内重复 RUN_REPEAT 次 (外加 1 次预热)，统计写到 <algo>/telemetry/<graph>.json
+        repeat = int(os.environ.get("RUN_REPEAT", "5"))
+        execute_live(["mkdir", "-p", "telemetry"], algo)
         execute_live(["bazel", "build", "//MIS/" + algo + ":MIS_main", "-c", "opt"], "..")
         with open(algo + "/benchmark.csv", 'w', newline='', encoding='utf-8') as f:
             writer = csv.writer(f)
-            writer.writerow(["graph name", "Running Time", "Counter Initialization Time", "1", "2", "3"])
+            writer.writerow(["graph name", "Running Time", "Running Time (min)", "Running Time (ci95)",
+                             "Counter Initialization Time", "rounds", "edges traversed", "repetitions"])
             for graph in graphs:
-                times = []
-                if record == "0":
-                    times += execute(["bazel-bin/MIS/" + algo + "/MIS_main", "-s", "-b", GRAPH_PATH + graph + ".bin"], "..")[1:]
-                    times += execute(["bazel-bin/MIS/" + algo + "/MIS_main", "-s", "-b", GRAPH_PATH + graph + ".bin"], "..")[1:]
-                else:
-                    times += execute(["bazel-bin/MIS/" + algo + "/MIS_main", "-s", "-b", "-verify", GRAPH_PATH + graph + ".bin"], "..")[1:]
-                pad_times_with_zeros(times)
-                times = np.array(times)
-                times = times.mean(axis=0).tolist()
-                row = [graph] + times
+                json_path = "MIS/" + algo + "/telemetry/" + graph + ".json"
+                flags = ["-verify"] if record != "0" else []
+                execute(["bazel-bin/MIS/" + algo + "/MIS_main", "-s", "-b", "-rounds", str(repeat + 1), "-json", json_path]
+                        + flags + cache + [GRAPH_PATH + graph + ".bin"], "..")
+                row = [graph] + summary_row(load_telemetry("../" + json_path))
                 print(row)
-                writer.writerow(row)
\ No newline at end of file
+                writer.writerow(row)
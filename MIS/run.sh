@@ -10,4 +10,25 @@ source ../utils/python/bin/activate
 # python3 run.py 12_test_all_atomic 0
 # python3 run.py 13_test_duplicate 0
 # python3 run.py 14_test_pointer 0
-python3 run.py 15_test_virtual 0
\ No newline at end of file
+python3 run.py 15_test_virtual 0
+# python3 run.py 17_prefetch 0
+# python3 modes.py 17_prefetch -prefetch 0 4 8 16 32
+# python3 run.py 18_sequential_amac 1
+# python3 run.py 19_sequential_dag_amac 1
+# SWEEP_THREADS=1,8,48,96,192 python3 sweep.py 05_deterministic 06_concurrent 07_perthread
+# python3 modes.py 20_placement -numa none interleave block
+# python3 modes.py 20_placement -huge none thp hugetlb
+# python3 modes.py 22_priority -priority perm hash degree kcore
+# MODES_ARGS=-count_decs python3 modes.py 22_priority -priority perm hash degree kcore    # 减一总次数 (计时不可比)
+# python3 run.py 24_dynamic 0
+# python3 modes.py 25_multi_seed -lanes 1 8 64
+# python3 run.py 26_executor 0
+# python3 run.py 05_deterministic 0 /tmp/mis_snapshots
+# python3 compare.py 05_deterministic 07_perthread
+# python3 run.py 27_state_counter 0
+# python3 modes.py 28_delegation -owners 8 48 192
+# python3 modes.py 29_propagation_blocking -pb_threshold 1 0.05 0    # 1 = 不分箱; 主要看 uk-2002_sym 和 sd_arc_sym
+# python3 modes.py 29_propagation_blocking -pb_bits 14 16 18
+# python3 run.py 30_liveness 0
+# python3 compare.py 05_deterministic 30_liveness
+# python3 modes.py 31_pruning -prune_threshold 1 0.5 0.25    # 1 = 不剪枝, 对比 Edges traversed 列
@@ -0,0 +1,120 @@
+import os
+import sys
+import csv
+import subprocess
+from config import *
+from run import execute_live, load_telemetry, summary_row
+
+# 线程数 / NUMA 策略扫描
+# 用法: python3 sweep.py <algo1> [<algo2> ...]
+# 对每个算法、每个图、每种 NUMA 策略、每个线程数跑一次 (进程内重复 RUN_REPEAT 次，外加 1 次预热)，记录
+#   运行时间、计数器初始化时间 (-json 记录里去掉预热后的中位数)、轮数 (最后一次运行)
+# 并和 01_sequential/benchmark.csv 里的串行时间比较，得到加速比和效率。
+# 每次运行的记录在 <algo>/telemetry/sweep_<graph>_<policy>_<threads>.json，
+# 原始数据写到 <algo>/sweep.csv，加速比表写到 <algo>/sweep_speedup.csv 和 <algo>/sweep_efficiency.csv
+#
+# 环境变量:
+#   SWEEP_THREADS  逗号分隔的线程数，默认 1,2,4,...,全部逻辑核
+#   SWEEP_POLICIES 逗号分隔的策略，默认 compact,scatter,interleave
+#     compact    : 先占满一个 NUMA 节点的核，再用下一个节点，内存 --localalloc
+#     scatter    : 轮流从每个节点取核，内存 --localalloc
+#     interleave : 和 scatter 一样取核，内存 --interleave=all
+#     none       : 不用 numactl
+#   RUN_REPEAT     每个配置计入统计的重复次数，默认 5 (和 run.py 一样)
+
+def cpu_topology():
+    # [(cpu, node)]，没有 lscpu 时当成单节点
+    try:
+        out = subprocess.run(["lscpu", "-p=CPU,NODE"], stdout=subprocess.PIPE,
+                             universal_newlines=True).stdout
+    except FileNotFoundError:
+        return [(c, 0) for c in range(os.cpu_count())]
+    cpus = []
+    for line in out.splitlines():
+        if line.startswith("#"):
+            continue
+        cpu, node = line.split(",")
+        cpus.append((int(cpu), int(node) if node else 0))
+    return cpus
+
+def pick_cpus(topology, policy, threads):
+    nodes = sorted(set(node for _, node in topology))
+    by_node = {node: [cpu for cpu, nd in topology if nd == node] for node in nodes}
+    if policy == "compact":
+        order = [cpu for node in nodes for cpu in by_node[node]]
+    else:
+        order = []
+        for i in range(max(len(v) for v in by_node.values())):
+            order += [by_node[node][i] for node in nodes if i < len(by_node[node])]
+    return order[:threads]
+
+def numactl_prefix(topology, policy, threads):
+    if policy == "none":
+        return []
+    cpus = ",".join(str(c) for c in pick_cpus(topology, policy, threads))
+    mem = "--interleave=all" if policy == "interleave" else "--localalloc"
+    return ["numactl", "--physcpubind=" + cpus, mem]
+
+def sequential_baseline():
+    times = {}
+    path = "01_sequential/benchmark.csv"
+    if os.path.exists(path):
+        with open(path, newline='', encoding='utf-8') as f:
+            for row in csv.DictReader(f):
+                times[row["graph name"]] = float(row["Running Time"])
+    return times
+
+def default_threads():
+    total = os.cpu_count()
+    threads, t = [], 1
+    while t < total:
+        threads.append(t)
+        t *= 2
+    return threads + [total]
+
+def write_table(path, rows, key, policies, threads):
+    with open(path, 'w', newline='', encoding='utf-8') as f:
+        writer = csv.writer(f)
+        writer.writerow(["graph name", "policy"] + [str(t) for t in threads])
+        for graph in graphs:
+            for policy in policies:
+                writer.writerow([graph, policy] + [rows.get((graph, policy, t), {}).get(key, "") for t in threads])
+
+if __name__ == "__main__":
+    algos = sys.argv[1:]
+    threads = [int(t) for t in os.environ.get("SWEEP_THREADS", "").split(",") if t] or default_threads()
+    repeat = int(os.environ.get("RUN_REPEAT", "5"))
+    policies = [p for p in os.environ.get("SWEEP_POLICIES", "compact,scatter,interleave").split(",") if p]
+    topology = cpu_topology()
+    baseline = sequential_baseline()
+    for algo in algos:
+        execute_live(["mkdir", "-p", "telemetry"], algo)
+        execute_live(["bazel", "build", "//MIS/" + algo + ":MIS_main", "-c", "opt"], "..")
+        rows = {}
+        with open(algo + "/sweep.csv", 'w', newline='', encoding='utf-8') as f:
+            writer = csv.writer(f)
+            writer.writerow(["graph name", "policy", "threads", "Running Time", "Counter Initialization Time",
+                             "rounds", "speedup", "efficiency"])
+            for graph in graphs:
+                for policy in policies:
+                    for t in threads:
+                        json_path = "MIS/" + algo + "/telemetry/sweep_" + graph + "_" + policy + "_" + str(t) + ".json"
+                        command = numactl_prefix(topology, policy, t) + \
+                            ["bazel-bin/MIS/" + algo + "/MIS_main", "-s", "-b", "-rounds", str(repeat + 1), "-json", json_path,
+                             GRAPH_PATH + graph + ".bin"]
+                        print(" ".join(command))
+                        env = dict(os.environ, PARLAY_NUM_THREADS=str(t))
+                        result = subprocess.run(command, cwd="..", env=env, stdout=subprocess.PIPE,
+                                                stderr=subprocess.PIPE, universal_newlines=True)
+                        if result.stderr:
+                            print(result.stderr)
+                        summary = summary_row(load_telemetry("../" + json_path))
+                        running_time, init_time, rounds = summary[0], summary[3], summary[4]
+                        speedup = baseline[graph] / running_time if graph in baseline and running_time > 0 else ""
+                        efficiency = speedup / t if speedup != "" else ""
+                        rows[(graph, policy, t)] = {"speedup": speedup, "efficiency": efficiency}
+                        row = [graph, policy, t, running_time, init_time, rounds, speedup, efficiency]
+                        print(row)
+                        writer.writerow(row)
+        write_table(algo + "/sweep_speedup.csv", rows, "speedup", policies, threads)
+        write_table(algo + "/sweep_efficiency.csv", rows, "efficiency", policies, threads)
@@ -3,4 +3,15 @@ python3 verify.py 03_baseline_random_greedy 05_deterministic
 #python3 verify.py 01_sequential 03_baseline_random_greedy
 #python3 verify.py 01_sequential 05_deterministic
 #python3 verify.py 01_sequential 06_concurrent
-#python3 verify.py 01_sequential 07_perthread
\ No newline at end of file
+#python3 verify.py 01_sequential 07_perthread
+#python3 verify.py 05_deterministic 17_prefetch
+#python3 verify.py 01_sequential 18_sequential_amac
+#python3 verify.py 02_sequential_dag 19_sequential_dag_amac
+#python3 verify.py 05_deterministic 20_placement
+#python3 verify.py 05_deterministic 22_priority
+#python3 verify.py 05_deterministic 26_executor
+#python3 verify.py 05_deterministic 27_state_counter
+#python3 verify.py 05_deterministic 28_delegation
+#python3 verify.py 05_deterministic 29_propagation_blocking
+#python3 verify.py 05_deterministic 30_liveness
+#python3 verify.py 05_deterministic 31_pruning
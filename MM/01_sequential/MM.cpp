@@ -0,0 +1,93 @@
+#include "graph_utils/graph.h"
+#include "edge_priority.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include <filesystem>
+using namespace parlay;
+
+// 串行 greedy 极大匹配: 所有无向边按 edge_priority::key 从小到大，两端都没匹配就加入
+// 返回 mate, 没匹配的点是 UINT32_MAX
+template <class Graph>
+std::vector<typename Graph::NodeId> MM(const Graph &G) {
+    using NodeId = typename Graph::NodeId;
+    size_t n = G.n;
+
+    struct keyed_edge { uint64_t key; NodeId u, v; };
+    std::vector<keyed_edge> edges;
+    edges.reserve(G.m / 2);
+    for (NodeId u = 0; u < n; u++) {
+        for (size_t e = G.offsets[u]; e < G.offsets[u + 1]; e++) {
+            NodeId v = G.edges[e].v;
+            if (u < v) edges.push_back({edge_priority::key(u, v), u, v});
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const keyed_edge& a, const keyed_edge& b) { return a.key < b.key; });
+
+    std::vector<NodeId> mate(n, UINT32_MAX);
+    for (const auto& e : edges) {
+        if (mate[e.u] == UINT32_MAX && mate[e.v] == UINT32_MAX) {
+            mate[e.u] = e.v;
+            mate[e.v] = e.u;
+        }
+    }
+    return mate;
+}
+
+// 输出格式: 匹配边数,u-v,u-v,...  (u < v, 按 u 升序)
+template <class NodeId>
+void save_mm_to_file(const std::vector<NodeId>& mate, const std::string& filename) {
+    // Create directory if needed
+    size_t last_slash = filename.find_last_of('/');
+    if (last_slash != std::string::npos) {
+        std::string dir = filename.substr(0, last_slash);
+        if (system(("mkdir -p " + dir).c_str()) != 0) { std::cerr << "Error: Cannot create " << dir << std::endl; }
+    }
+
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        std::cerr << "Error: Cannot open output file " << filename << std::endl;
+        return;
+    }
+
+    size_t cnt = 0;
+    for (size_t u = 0; u < mate.size(); u++) cnt += (mate[u] != UINT32_MAX && u < mate[u]);
+    out << cnt;
+    for (size_t u = 0; u < mate.size(); u++) {
+        if (mate[u] != UINT32_MAX && u < mate[u]) out << "," << u << "-" << mate[u];
+    }
+    out.close();
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) { std::cerr << "Usage: ./MM input_graph [verify]" << std::endl; return 1; }
+    const char* filename = argv[1];
+    Graph<uint32_t, uint64_t> G;
+    G.read_symmetric_graph(filename);
+    std::cout << "## Graph load time = " << G.load_time << "\n";
+    std::string graphname = std::filesystem::path(filename).stem().string();
+    // Warm up
+    { auto tmp = MM(G); }
+    // Test
+    std::vector<double> times;
+    for (int run = 1; run <= 3; run++) {
+        internal::timer t;
+        auto mate = MM(G);
+        t.stop();
+        times.push_back(t.total_time());
+    }
+    double avg_time = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    std::cout << avg_time << "\n";
+    // Verify
+    bool verify = false;
+    if (argc == 3) verify = (std::atoi(argv[2]) != 0);
+    if (verify) {
+        auto mate = MM(G);
+        std::string output_file = "./output/" + graphname + ".txt";
+        save_mm_to_file(mate, output_file);
+    }
+    return 0;
+}
@@ -0,0 +1,2 @@
+make
+./MM ../../utils/small_graph.bin
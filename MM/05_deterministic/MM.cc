@@ -0,0 +1,53 @@
+#include "MM.h"
+#include "telemetry.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+inline std::string get_graphname(const std::string& fullpath) {
+    std::string name = fullpath;
+    size_t pos1 = name.find_last_of('/'); if (pos1 != std::string::npos) name = name.substr(pos1 + 1);
+    size_t pos2 = name.find_last_of('.'); if (pos2 != std::string::npos) name = name.substr(0, pos2);
+    return name;
+}
+
+// 输出格式: 匹配边数,u-v,u-v,...  (u < v, 按 u 升序)
+template <typename T>
+void print_mm(parlay::sequence<T>& mate, std::string algo, std::string graphname) {
+    std::ofstream out("MM/" + algo + "/output/" + graphname + ".txt");
+    size_t cnt = 0; for (size_t i = 0; i < mate.size(); i++) cnt += (mate[i] != UINT_E_MAX && i < mate[i]); out << cnt;
+    for (size_t i = 0; i < mate.size(); i++) { if (mate[i] != UINT_E_MAX && i < mate[i]) { out << "," << i << "-" << mate[i]; } }
+    out.close();
+}
+
+
+namespace gbbs {
+
+template <class Graph>
+double MaximalMatching_runner(Graph& G, commandLine P) {
+    std::cout << "### ===================================================================" << std::endl;
+    std::cout << "### Application: MM" << std::endl;
+    std::cout << "### Graph: " << P.getArgument(0) << std::endl;
+    std::cout << "### Threads: " << num_workers() << std::endl;
+    std::cout << "### n: " << G.n << std::endl;
+    std::cout << "### m: " << G.m << std::endl;
+    std::string json = P.getOptionValue("-json", "");
+    telemetry::enable(!json.empty());
+    std::cout << "### Params: -verify = " << bool(P.getOption("-verify")) << std::endl;
+
+    double tt = 0.0; timer t; t.start();
+    auto mate = MaximalMatching_rootset::MaximalMatching(G);
+    tt = t.stop(); std::cout << "### Running Time: " << tt << std::endl;
+    telemetry::finish(tt);
+    if (!json.empty()) telemetry::write(json, {get_graphname(P.getArgument(0)), "05_deterministic", G.n, G.m, size_t(num_workers()), 0});
+
+    if (P.getOption("-verify")) {
+        std::cout << "## Verify: " << (MaximalMatching_rootset::check_matching(G, mate) ? "OK" : "FAILED") << std::endl;
+        print_mm(mate, "05_deterministic", get_graphname(P.getArgument(0)));
+    }
+    return tt;
+}
+
+} // namespace gbbs
+
+generate_main(gbbs::MaximalMatching_runner, false);
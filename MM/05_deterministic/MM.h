@@ -0,0 +1,141 @@
+#pragma once
+#include <vector>
+#include "gbbs/gbbs.h"
+#include "deterministic_counter.h"
+#include "edge_priority.h"
+#include "telemetry.h"
+
+namespace gbbs {
+namespace MaximalMatching_rootset {
+
+// 边上的 priority DAG: 边 e 依赖和它相邻、优先级更高 (key 更小) 的边。
+// 计数器按 CSR 边号存放，一条无向边 {y, z} 有两个计数器:
+//   counters[y->z] = y 处比 {y, z} 优先级高、还没被删掉的边数
+//   counters[z->y] = z 处同理
+// 两个都为 0 时这条边进入匹配。顶点 x 被匹配后，x 的其它边 {x, y} 都被删掉，
+// 对 y 处所有比 {x, y} 优先级低的边 y->z 做减一。
+
+template <class Graph>
+struct csr {
+    Graph& G;
+    sequence<size_t> offsets;
+    explicit csr(Graph& _G) : G(_G) {
+        size_t n = G.n;
+        offsets = parlay::tabulate(n + 1, [&](size_t v) -> size_t {
+            return (v == n) ? 0 : G.get_vertex(v).out_neighbors().get_degree();
+        });
+        parlay::scan_inplace(offsets);
+    }
+    inline size_t degree(uintE v) const { return offsets[v + 1] - offsets[v]; }
+    inline uintE ngh(uintE v, size_t j) const { return std::get<0>(G.get_vertex(v).out_neighbors().get_edges()[j]); }
+    // 边 v->w 的 CSR 边号 (邻接表按点号有序，二分查找)
+    inline size_t edge_id(uintE v, uintE w) const {
+        auto* e = G.get_vertex(v).out_neighbors().get_edges();
+        size_t lo = 0, hi = degree(v);
+        while (lo < hi) { size_t mid = (lo + hi) / 2; if (std::get<0>(e[mid]) < w) lo = mid + 1; else hi = mid; }
+        return offsets[v] + lo;
+    }
+};
+
+using edge = std::pair<uintE, uintE>;
+
+// 返回 mate，没匹配的点是 UINT_E_MAX
+template <class Graph>
+inline sequence<uintE> MaximalMatching(Graph& G) {
+    size_t n = G.n, m = G.m;
+
+    // 初始化计数器: counters[v->w] = {v, w} 在 v 的边里按 key 的排名
+    timer t1; t1.start();
+    csr<Graph> C(G);
+    auto counters = sequence<Counter>(m, Counter(0));
+    parallel_for(0, n, [&](size_t v) {
+        auto* e = G.get_vertex(v).out_neighbors().get_edges();
+        size_t d = C.degree(v);
+        auto keys = parlay::tabulate(d, [&](size_t j) { return std::make_pair(edge_priority::key(v, std::get<0>(e[j])), j); });
+        parlay::sort_inplace(keys);
+        parallel_for(0, d, [&](size_t r) { counters[C.offsets[v] + keys[r].second].value = static_cast<int>(r); });
+    }, 1);
+    double init_time = t1.stop();
+    std::cout << "## Counter initialization time = " << init_time << std::endl;
+    telemetry::init(init_time);
+
+    // 初始化 rootset: 两端计数器都为 0 的边 (每条边只在较小的端点处取一次)
+    auto roots = parlay::flatten(parlay::tabulate(n, [&](size_t v) {
+        sequence<edge> r;
+        for (size_t j = 0; j < C.degree(v); j++) {
+            uintE w = C.ngh(v, j);
+            if (v < w && !counters[C.offsets[v] + j].not_zero() && !counters[C.edge_id(w, v)].not_zero()) r.push_back({uintE(v), w});
+        }
+        return r;
+    }));
+
+    auto mate = sequence<uintE>(n, UINT_E_MAX);
+    auto claimed = sequence<bool>(m, false);    // 按较小端点处的边号，防止两端同时减到 0 时重复加入
+    std::vector<std::vector<edge>> found(num_workers());
+    size_t rounds = 0;
+    while (roots.size() > 0) {
+        timer nr; nr.start();
+        parallel_for(0, roots.size(), [&](size_t i) {                                    // roots加入匹配
+            mate[roots[i].first] = roots[i].second; mate[roots[i].second] = roots[i].first;
+        });
+        // 被匹配的点 x 的其它边 {x, y} 被删除，y 处优先级更低的边减一，两端都到 0 的成为新的 roots
+        parallel_for(0, 2 * roots.size(), [&](size_t i) {
+            uintE x = (i & 1) ? roots[i / 2].second : roots[i / 2].first;
+            parallel_for(0, C.degree(x), [&](size_t j) {
+                uintE y = C.ngh(x, j);
+                if (mate[y] != UINT_E_MAX) return;
+                uint64_t removed_key = edge_priority::key(x, y);
+                auto* e = G.get_vertex(y).out_neighbors().get_edges();
+                parallel_for(0, C.degree(y), [&](size_t k) {
+                    uintE z = std::get<0>(e[k]);
+                    if (edge_priority::key(y, z) <= removed_key) return;
+                    if (!counters[C.offsets[y] + k].decrement_atomic()) return;
+                    if (mate[z] != UINT_E_MAX) return;
+                    size_t other = C.edge_id(z, y);
+                    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+                    if (counters[other].not_zero()) return;
+                    size_t canonical = (y < z) ? C.offsets[y] + k : other;
+                    if (__atomic_test_and_set(&claimed[canonical], __ATOMIC_RELAXED)) return;
+                    found[worker_id()].push_back({std::min(y, z), std::max(y, z)});
+                }, 1024);
+            }, 64);
+        }, 1);
+        auto new_roots = parlay::flatten(parlay::map(found, [](const auto& f) { return sequence<edge>(f.begin(), f.end()); }));
+        for (auto& f : found) f.clear();
+        rounds++;
+        double rt = nr.stop();
+        if (telemetry::enabled()) {                                                       // 被匹配的点和它们的度数
+            size_t edges = telemetry::untimed([&] {
+                return parlay::reduce(parlay::delayed_seq<size_t>(roots.size(), [&](size_t i) {
+                    return C.degree(roots[i].first) + C.degree(roots[i].second);
+                }));
+            });
+            telemetry::round(roots.size(), 2 * roots.size(), edges, rt);
+        }
+        roots = std::move(new_roots);
+        std::cout << "## round = " << rounds << " time = " << rt << "\n";
+    }
+    return mate;
+}
+
+// 合法 (mate 对称且是图中的边) 并且极大 (没有两端都没匹配的边)
+template <class Graph>
+inline bool check_matching(Graph& G, const sequence<uintE>& mate) {
+    csr<Graph> C(G);
+    auto bad = parlay::delayed_seq<bool>(G.n, [&](size_t v) {
+        uintE w = mate[v];
+        if (w != UINT_E_MAX) {
+            if (mate[w] != v) return true;
+            size_t id = C.edge_id(v, w);
+            if (id == C.offsets[v + 1] || C.ngh(v, id - C.offsets[v]) != w) return true;
+            return false;
+        }
+        for (size_t j = 0; j < C.degree(v); j++) if (mate[C.ngh(v, j)] == UINT_E_MAX) return true;
+        return false;
+    });
+    return parlay::count(bad, true) == 0;
+}
+
+
+}  // namespace MaximalMatching_rootset
+}  // namespace gbbs
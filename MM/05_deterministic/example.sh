@@ -0,0 +1,5 @@
+cd ../..
+bazel build //MM/05_deterministic:MM_main -c opt
+# bazel-bin/MM/05_deterministic/MM_main -s -b utils/small_graph.bin
+bazel-bin/MM/05_deterministic/MM_main -s -b /home/csgrads/xjian140/Counter3/testcases/bin/friendster_sym.bin
+cd MM/05_deterministic
\ No newline at end of file
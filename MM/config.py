@@ -0,0 +1,11 @@
+import os
+import importlib.util
+
+# 图的路径和列表和 MIS 共用，直接读 ../MIS/config.py
+_spec = importlib.util.spec_from_file_location(
+    "mis_config", os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "MIS", "config.py"))
+_mis_config = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(_mis_config)
+
+GRAPH_PATH = _mis_config.GRAPH_PATH
+graphs = _mis_config.graphs
@@ -0,0 +1,3 @@
+# python3 ../utils/run_app.py MM 01_sequential 1
+python3 ../utils/run_app.py MM 05_deterministic 0
+python3 verify.py 01_sequential 05_deterministic
@@ -0,0 +1 @@
+python3 verify.py 01_sequential 05_deterministic
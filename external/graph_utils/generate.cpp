@@ -0,0 +1,59 @@
+#include "graph_utils/generators.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// 生成合成图并写成 read_binary_format 能直接读的 .bin（对称图，文件名需含 "sym"）
+//   ./generate rmat    <scale> <num_edges> <out> [-a 0.57] [-b 0.19] [-c 0.19] [-seed s]
+//   ./generate ba      <n> <k>             <out> [-seed s]
+//   ./generate grid2d  <x> <y>             <out> [-p 0.7] [-seed s]
+//   ./generate grid3d  <x> <y> <z>         <out> [-p 0.5] [-seed s]
+//   ./generate regular <n> <d>             <out> [-seed s]
+
+static double get_option(int argc, char* argv[], const char* name, double def) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], name) == 0) return std::atof(argv[i + 1]);
+    }
+    return def;
+}
+
+int main(int argc, char* argv[]) {
+    int positional = 0;
+    while (positional + 1 < argc && argv[positional + 1][0] != '-') positional++;
+    if (positional < 1) { std::cerr << "Usage: ./generate rmat|ba|grid2d|grid3d|regular <params...> <out> [options]" << std::endl; return 1; }
+    std::string kind = argv[1];
+    uint64_t seed = static_cast<uint64_t>(get_option(argc, argv, "-seed", 1));
+    auto arg = [&](int i) { return std::strtoull(argv[i], nullptr, 10); };
+
+    parlay::internal::timer t;
+    generators::graph_t G;
+    const char* out = nullptr;
+    if (kind == "rmat" && positional == 4) {
+        G = generators::rmat(arg(2), arg(3), get_option(argc, argv, "-a", 0.57),
+                             get_option(argc, argv, "-b", 0.19), get_option(argc, argv, "-c", 0.19), seed);
+        out = argv[4];
+    } else if (kind == "ba" && positional == 4) {
+        G = generators::barabasi_albert(arg(2), arg(3), seed);
+        out = argv[4];
+    } else if (kind == "grid2d" && positional == 4) {
+        G = generators::grid(arg(2), arg(3), 1, get_option(argc, argv, "-p", 0.7), seed);
+        out = argv[4];
+    } else if (kind == "grid3d" && positional == 5) {
+        G = generators::grid(arg(2), arg(3), arg(4), get_option(argc, argv, "-p", 0.5), seed);
+        out = argv[5];
+    } else if (kind == "regular" && positional == 4) {
+        G = generators::random_regular(arg(2), arg(3), seed);
+        out = argv[4];
+    } else {
+        std::cerr << "Error: unknown generator or wrong number of parameters: " << kind << std::endl;
+        return 1;
+    }
+    t.stop();
+    std::cout << "n = " << G.n << ", m = " << G.m << ", time = " << t.total_time() << std::endl;
+    if (std::string(out).find("sym") == std::string::npos) {
+        std::cerr << "Warning: " << out << " has no \"sym\" in its name, read_graph will treat it as directed" << std::endl;
+    }
+    G.write_binary_format(out);
+    return 0;
+}
@@ -0,0 +1,132 @@
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <cstdint>
+
+#include "graph.h"
+#include "parlay/primitives.h"
+#include "parlay/sequence.h"
+#include "parlay/utilities.h"
+
+// Parallel synthetic graph generators. Every generator is a pure function of
+// its parameters and the seed (randomness comes from hashing (seed, index)),
+// so the same call produces the same graph for any number of threads. All of
+// them return symmetric, unweighted graphs without self-loops or duplicate
+// edges, ready for write_binary_format.
+namespace generators {
+
+using graph_t = Graph<uint32_t, uint64_t>;
+
+// Uniform random number in [0, 1) for the idx-th draw of stream `seed`.
+inline double uniform(uint64_t seed, uint64_t idx) {
+  uint64_t h = parlay::hash64(parlay::hash64(seed) ^ idx);
+  return (h >> 11) * (1.0 / 9007199254740992.0);
+}
+
+inline uint64_t random_below(uint64_t seed, uint64_t idx, uint64_t bound) {
+  return parlay::hash64(parlay::hash64(seed) ^ idx) % bound;
+}
+
+// Packs an undirected edge list (one direction per edge) into both
+// directions and builds the CSR.
+template <class F>
+graph_t from_edge_function(size_t n, size_t num_edges, F edge) {
+  auto keys = parlay::sequence<uint64_t>::uninitialized(num_edges * 2);
+  parlay::parallel_for(0, num_edges, [&](size_t i) {
+    auto [u, v] = edge(i);
+    keys[i * 2 + 0] = (uint64_t(u) << 32) | v;
+    keys[i * 2 + 1] = (uint64_t(v) << 32) | u;
+  });
+  return symmetric_graph_from_keys<graph_t>(n, keys);
+}
+
+// R-MAT on 2^scale vertices with num_edges sampled edges. Each edge picks one
+// quadrant per level with probabilities a, b, c and d = 1 - a - b - c.
+inline graph_t rmat(size_t scale, size_t num_edges, double a, double b,
+                    double c, uint64_t seed) {
+  size_t n = size_t(1) << scale;
+  return from_edge_function(n, num_edges, [&](size_t i) {
+    uint32_t u = 0, v = 0;
+    for (size_t level = 0; level < scale; level++) {
+      double r = uniform(seed, i * scale + level);
+      uint32_t q = (r < a) ? 0 : (r < a + b) ? 1 : (r < a + b + c) ? 2 : 3;
+      u = (u << 1) | (q >> 1);
+      v = (v << 1) | (q & 1);
+    }
+    return std::make_pair(u, v);
+  });
+}
+
+// Barabási–Albert preferential attachment: vertex v attaches k edges, each to
+// an endpoint of a uniformly chosen earlier edge slot (Batagelj–Brandes). A
+// slot's endpoint is resolved by following the random choices backwards
+// until an even slot (which stores its own vertex) is reached, so every edge
+// is generated independently and in parallel.
+inline graph_t barabasi_albert(size_t n, size_t k, uint64_t seed) {
+  return from_edge_function(n, n * k, [&](size_t e) {
+    uint32_t u = e / k;
+    uint64_t slot = random_below(seed, e, 2 * e + 1);
+    while (slot & 1) {
+      uint64_t prev = slot / 2;
+      slot = random_below(seed, prev, 2 * prev + 1);
+    }
+    uint32_t v = (slot / 2) / k;
+    return std::make_pair(u, v);
+  });
+}
+
+// 2D (z == 1) or 3D lattice. Each lattice edge is kept with probability
+// keep, which turns the regular degree-4/6 grid into the low, skewed degree
+// distribution of road networks (keep = 0.7 in 2D gives average degree ~2.8).
+inline graph_t grid(size_t x, size_t y, size_t z, double keep,
+                    uint64_t seed) {
+  size_t n = x * y * z;
+  size_t dims = (z > 1) ? 3 : 2;
+  auto id = [&](size_t i, size_t j, size_t l) -> uint32_t {
+    return (l * y + j) * x + i;
+  };
+  // candidate edge c = vertex * dims + direction, towards +x, +y or +z
+  auto candidate = [&](size_t c) {
+    size_t vtx = c / dims, dir = c % dims;
+    size_t i = vtx % x, j = (vtx / x) % y, l = vtx / (x * y);
+    bool inside = (dir == 0 && i + 1 < x) || (dir == 1 && j + 1 < y) ||
+                  (dir == 2 && l + 1 < z);
+    return inside && uniform(seed, c) < keep;
+  };
+  auto kept = parlay::pack_index<uint64_t>(
+      parlay::delayed_seq<bool>(n * dims, candidate));
+  return from_edge_function(n, kept.size(), [&](size_t e) {
+    size_t c = kept[e];
+    size_t vtx = c / dims, dir = c % dims;
+    size_t i = vtx % x, j = (vtx / x) % y, l = vtx / (x * y);
+    uint32_t v = (dir == 0)   ? id(i + 1, j, l)
+                 : (dir == 1) ? id(i, j + 1, l)
+                              : id(i, j, l + 1);
+    return std::make_pair(uint32_t(vtx), v);
+  });
+}
+
+// Random d-regular graph from the configuration model: n * d stubs are
+// paired after sorting them on a seeded hash (a random permutation).
+// Self-loops and duplicate edges are dropped, so a few vertices end up with
+// degree slightly below d.
+inline graph_t random_regular(size_t n, size_t d, uint64_t seed) {
+  size_t stubs = n * d;
+  if (stubs % 2 == 1) {
+    std::cerr << "Error: n * d must be even for a d-regular graph"
+              << std::endl;
+    abort();
+  }
+  uint64_t h = parlay::hash64(seed);
+  auto perm = parlay::integer_sort(
+      parlay::tabulate(stubs, [](size_t i) { return uint64_t(i); }),
+      [&](uint64_t i) { return parlay::hash64(h ^ i); });
+  return from_edge_function(n, stubs / 2, [&](size_t e) {
+    return std::make_pair(uint32_t(perm[2 * e] / d),
+                          uint32_t(perm[2 * e + 1] / d));
+  });
+}
+
+}  // namespace generators
+
+#endif  // GENERATORS_H
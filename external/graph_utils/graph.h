@@ -7,14 +7,18 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <fstream>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "parlay/internal/get_time.h"
 #include "parlay/io.h"
 #include "parlay/parallel.h"
+#include "parlay/primitives.h"
 #include "parlay/sequence.h"
 #include "parlay/utilities.h"
 #include "utils.h"
@@ -60,6 +64,7 @@ class Graph {
   size_t m;
   bool symmetrized;
   bool weighted;
+  double load_time = 0;  // seconds spent in read_graph
   parlay::sequence<EdgeId> offsets;
   parlay::sequence<Edge> edges;
   parlay::sequence<EdgeId> in_offsets;
@@ -251,6 +256,8 @@ class Graph {
       munmap(data, len);
     }
     close(fd);
+    symmetrized = true;
+    weighted = false;
   }
 
   void read_directed_binary_format(char const *filename) {
@@ -283,38 +290,43 @@ class Graph {
     }
     auto in_offsets_ptr = reinterpret_cast<uint64_t *>(data + 3 * 8);
     in_offsets = parlay::sequence<EdgeId>::uninitialized(n + 1);
-    for (size_t i = 0; i < n + 1; i++) {
-      in_offsets[i] = in_offsets_ptr[i];
-    }
+    parlay::parallel_for(0, n + 1,
+                         [&](size_t i) { in_offsets[i] = in_offsets_ptr[i]; });
     auto in_edges_ptr =
         reinterpret_cast<uint32_t *>(data + 3 * 8 + (n + 1) * 8);
-    in_edges = parlay::sequence<Edge>(m);
-    for (size_t i = 0; i < m; i++) {
-      in_edges[i].v = in_edges_ptr[i];
-    }
-    parlay::sequence<size_t> out_degree(n, 0);
-    for (size_t dest = 0; dest < n; dest++) {
-      for (size_t j = in_offsets[dest]; j < in_offsets[dest + 1]; j++) {
-        NodeId src = in_edges[j].v;
-        out_degree[src]++;
-      }
-    }
-    offsets = parlay::sequence<EdgeId>(n + 1);
+    in_edges = parlay::sequence<Edge>::uninitialized(m);
+    parlay::parallel_for(0, m,
+                         [&](size_t i) { in_edges[i].v = in_edges_ptr[i]; });
+    // out-degree histogram over the in-edge sources, then scan into offsets
+    auto sources = parlay::delayed_seq<NodeId>(
+        m, [&](size_t j) { return in_edges[j].v; });
+    auto out_degree =
+        parlay::histogram_by_index(sources, static_cast<EdgeId>(n));
+    offsets = parlay::sequence<EdgeId>::uninitialized(n + 1);
     offsets[0] = 0;
-    for (size_t i = 1; i <= n; i++) {
-      offsets[i] = offsets[i - 1] + out_degree[i - 1];
-    }
-    edges = parlay::sequence<Edge>(m);
-    parlay::sequence<size_t> out_pos(n, 0);
-    for (size_t dest = 0; dest < n; dest++) {
-      for (size_t j = in_offsets[dest]; j < in_offsets[dest + 1]; j++) {
-        NodeId src = in_edges[j].v;
-        size_t pos = offsets[src] + out_pos[src]++;
-        edges[pos].v = dest;
-      }
-    }
+    parlay::parallel_for(0, n,
+                         [&](size_t i) { offsets[i + 1] = out_degree[i]; });
+    parlay::scan_inclusive_inplace(offsets);
+    // scatter (src, dest) into the out-CSR. integer_sort is a blocked counting
+    // sort (per-block bucket counts and per-block write cursors) and is stable,
+    // so every out-list keeps destinations in ascending order, same as the
+    // sequential build.
+    auto pairs = parlay::sequence<std::pair<NodeId, NodeId>>::uninitialized(m);
+    parlay::parallel_for(0, n, [&](size_t dest) {
+      parlay::parallel_for(
+          in_offsets[dest], in_offsets[dest + 1], [&](size_t j) {
+            pairs[j] = std::make_pair(in_edges[j].v, static_cast<NodeId>(dest));
+          });
+    });
+    auto sorted = parlay::integer_sort(
+        pairs, [](const std::pair<NodeId, NodeId> &p) { return p.first; });
+    edges = parlay::sequence<Edge>::uninitialized(m);
+    parlay::parallel_for(0, m,
+                         [&](size_t i) { edges[i].v = sorted[i].second; });
     munmap(data, len);
     close(fd);
+    symmetrized = false;
+    weighted = false;
   }
 
   void read_hyperlink2012(const char *filename) {
@@ -344,9 +356,104 @@ class Graph {
       abort();
     }
     ifs.close();
+    symmetrized = false;
+    weighted = false;
   }
 
   void read_graph(const char *filename) {
+    parlay::internal::timer t;
+    read_graph_by_format(filename);
+    t.stop();
+    load_time = t.total_time();
+  }
+
+  // Reads the graph and symmetrizes it if needed. The symmetrized version of
+  // a directed input is cached next to it (see symmetrized_cache_path) and
+  // reused as long as the input's size and mtime are unchanged.
+  void read_symmetric_graph(const char *filename) {
+    parlay::internal::timer t;
+    std::string cache = symmetrized_cache_path(filename);
+    uint64_t key[3];
+    bool has_key = symmetrized_cache_key(filename, key);
+    if (has_key && valid_symmetrized_cache(cache, key)) {
+      read_binary_format(cache.c_str());
+    } else {
+      read_graph_by_format(filename);
+      if (!symmetrized) {
+        *this = make_symmetrized(*this);
+        if (has_key) write_symmetrized_cache(cache, key);
+      }
+    }
+    t.stop();
+    load_time = t.total_time();
+  }
+
+  // foo.bin -> foo.cache_sym.bin. The name contains "sym" so read_graph
+  // loads the cache as a symmetric binary graph.
+  static std::string symmetrized_cache_path(const char *filename) {
+    std::string path(filename);
+    size_t idx = path.find_last_of('.');
+    if (idx == std::string::npos || idx < path.find_last_of('/') + 1) {
+      return path + ".cache_sym.bin";
+    }
+    return path.substr(0, idx) + ".cache_sym.bin";
+  }
+
+  static constexpr uint64_t kSymCacheMagic = 0x45484341434d5953;  // "SYMCACHE"
+
+  // {magic, size, mtime in ns} of the input file
+  static bool symmetrized_cache_key(const char *filename, uint64_t key[3]) {
+    struct stat sb;
+    if (stat(filename, &sb) == -1) {
+      return false;
+    }
+    key[0] = kSymCacheMagic;
+    key[1] = sb.st_size;
+    key[2] = uint64_t(sb.st_mtim.tv_sec) * 1000000000ull + sb.st_mtim.tv_nsec;
+    return true;
+  }
+
+  // The cache is a regular binary graph followed by the 3-word key, which
+  // read_binary_format ignores.
+  static bool valid_symmetrized_cache(const std::string &cache,
+                                      const uint64_t key[3]) {
+    std::ifstream ifs(cache, std::ios::binary | std::ios::ate);
+    if (!ifs.is_open()) {
+      return false;
+    }
+    size_t len = ifs.tellg();
+    uint64_t header[3], trailer[3];
+    if (len < 6 * sizeof(uint64_t)) {
+      return false;
+    }
+    ifs.seekg(0);
+    ifs.read(reinterpret_cast<char *>(header), sizeof(header));
+    ifs.seekg(len - sizeof(trailer));
+    ifs.read(reinterpret_cast<char *>(trailer), sizeof(trailer));
+    return ifs.good() && header[2] + sizeof(trailer) == len &&
+           std::equal(trailer, trailer + 3, key);
+  }
+
+  void write_symmetrized_cache(const std::string &cache,
+                               const uint64_t key[3]) {
+    std::string tmp = cache + ".tmp";
+    if (!std::ofstream(tmp, std::ios::binary).is_open()) {
+      std::cerr << "Warning: Cannot write symmetrized cache " << cache
+                << std::endl;
+      return;
+    }
+    write_binary_format(tmp.c_str());
+    std::ofstream ofs(tmp, std::ios::binary | std::ios::app);
+    ofs.write(reinterpret_cast<const char *>(key), 3 * sizeof(uint64_t));
+    ofs.close();
+    if (!ofs || rename(tmp.c_str(), cache.c_str()) != 0) {
+      std::cerr << "Warning: Cannot write symmetrized cache " << cache
+                << std::endl;
+      unlink(tmp.c_str());
+    }
+  }
+
+  void read_graph_by_format(const char *filename) {
     std::string str_filename(filename);
     if (str_filename.find("hyperlink2012.bin") != std::string::npos) {
       read_hyperlink2012(filename);
@@ -743,6 +850,44 @@ Graph<NodeId, EdgeId, EdgeTy> edgelist2graph(
   return G;
 }
 
+// Builds a symmetric, unweighted graph from packed (u << 32 | v) keys that
+// already contain both directions of every edge. The keys are radix sorted,
+// then duplicate edges and self-loops are dropped.
+template <class Graph>
+Graph symmetric_graph_from_keys(size_t n, parlay::sequence<uint64_t> &keys) {
+  using NodeId = typename Graph::NodeId;
+  using EdgeId = typename Graph::EdgeId;
+  using Edge = typename Graph::Edge;
+  static_assert(sizeof(NodeId) <= 4, "packed keys need 32-bit vertex ids");
+  parlay::integer_sort_inplace(keys, [](uint64_t k) { return k; });
+  auto pred = parlay::delayed_seq<bool>(keys.size(), [&](size_t i) {
+    uint64_t k = keys[i];
+    return (k >> 32) != (k & 0xffffffff) && (i == 0 || k != keys[i - 1]);
+  });
+  keys = parlay::pack(keys, pred);
+  Graph S;
+  S.n = n;
+  S.m = keys.size();
+  S.symmetrized = true;
+  S.weighted = false;
+  S.offsets = parlay::sequence<EdgeId>(n + 1, S.m);
+  S.edges = parlay::sequence<Edge>::uninitialized(S.m);
+  parlay::parallel_for(0, S.m, [&](size_t i) {
+    NodeId u = keys[i] >> 32;
+    S.edges[i].v = keys[i] & 0xffffffff;
+    if (i == 0 || (keys[i - 1] >> 32) != u) {
+      S.offsets[u] = i;
+    }
+  });
+  parlay::scan_inclusive_inplace(
+      parlay::make_slice(S.offsets.rbegin(), S.offsets.rend()),
+      parlay::minm<EdgeId>());
+  return S;
+}
+
+// Unweighted graphs with 32-bit ids are symmetrized by radix sorting packed
+// (u << 32 | v) keys, which is much cheaper than a comparison sort over
+// (NodeId, Edge) pairs. Duplicate edges and self-loops are dropped.
 template <class Graph>
 Graph make_symmetrized(const Graph &G) {
   size_t n = G.n;
@@ -751,28 +896,44 @@ Graph make_symmetrized(const Graph &G) {
   using EdgeId = typename Graph::EdgeId;
   using EdgeTy = typename Graph::EdgeTy;
   using Edge = typename Graph::Edge;
-  parlay::sequence<std::pair<NodeId, Edge>> edgelist(m * 2);
-  parlay::parallel_for(0, n, [&](NodeId u) {
-    parlay::parallel_for(G.offsets[u], G.offsets[u + 1], [&](EdgeId i) {
-      NodeId v = G.edges[i].v;
-      EdgeTy w = G.edges[i].w;
-      edgelist[i * 2 + 0] = std::make_pair(u, Edge(v, w));
-      edgelist[i * 2 + 1] = std::make_pair(v, Edge(u, w));
+  if constexpr (std::is_same_v<EdgeTy, Empty> && sizeof(NodeId) <= 4) {
+    auto keys = parlay::sequence<uint64_t>::uninitialized(m * 2);
+    parlay::parallel_for(0, n, [&](NodeId u) {
+      parlay::parallel_for(G.offsets[u], G.offsets[u + 1], [&](EdgeId i) {
+        uint64_t v = G.edges[i].v;
+        keys[i * 2 + 0] = (uint64_t(u) << 32) | v;
+        keys[i * 2 + 1] = (v << 32) | u;
+      });
     });
-  });
-  sort_inplace(make_slice(edgelist));
-  auto pred = parlay::delayed_seq<bool>(m * 2, [&](size_t i) {
-    if (i > 0 && edgelist[i].first == edgelist[i - 1].first &&
-        edgelist[i].second.v == edgelist[i - 1].second.v) {
-      return false;
-    }
-    if (edgelist[i].first == edgelist[i].second.v) {
-      return false;
-    }
-    return true;
-  });
-  edgelist = parlay::pack(make_slice(edgelist), pred);
-  return edgelist2graph<NodeId, EdgeId, EdgeTy>(edgelist, n, edgelist.size());
+    return symmetric_graph_from_keys<Graph>(n, keys);
+  } else {
+    parlay::sequence<std::pair<NodeId, Edge>> edgelist(m * 2);
+    parlay::parallel_for(0, n, [&](NodeId u) {
+      parlay::parallel_for(G.offsets[u], G.offsets[u + 1], [&](EdgeId i) {
+        NodeId v = G.edges[i].v;
+        EdgeTy w = G.edges[i].w;
+        edgelist[i * 2 + 0] = std::make_pair(u, Edge(v, w));
+        edgelist[i * 2 + 1] = std::make_pair(v, Edge(u, w));
+      });
+    });
+    sort_inplace(make_slice(edgelist));
+    auto pred = parlay::delayed_seq<bool>(m * 2, [&](size_t i) {
+      if (i > 0 && edgelist[i].first == edgelist[i - 1].first &&
+          edgelist[i].second.v == edgelist[i - 1].second.v) {
+        return false;
+      }
+      if (edgelist[i].first == edgelist[i].second.v) {
+        return false;
+      }
+      return true;
+    });
+    edgelist = parlay::pack(make_slice(edgelist), pred);
+    auto S = edgelist2graph<NodeId, EdgeId, EdgeTy>(edgelist, n,
+                                                    edgelist.size());
+    S.symmetrized = true;
+    S.weighted = G.weighted;
+    return S;
+  }
 }
 
 template <class Graph>
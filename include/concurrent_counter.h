@@ -13,6 +13,13 @@ struct ParCounter {
     inline void operator--(int) noexcept { decrement(); }
     inline bool is_zero() const noexcept { return value->load()==0; }
     inline bool set_zero() noexcept { if(value->load()>0){ value->fetch_add(-value->load(),parlay::worker_id()); return true;} return false; }
+    // 从 threshold + 1 变成 threshold 的那一次返回 true (fetch_add 返回旧值，只有一次)；已经 <= threshold 时不再减
+    inline bool decrement_until(int threshold) noexcept {
+        if (value->load() <= threshold) return false;
+        return value->fetch_add(-1,parlay::worker_id()) == threshold + 1;
+    }
+    inline bool decrement_until_atomic(int threshold) noexcept { return decrement_until(threshold); }
+    inline int get() const noexcept { return value->load(); }
 };
 
 /*
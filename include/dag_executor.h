@@ -0,0 +1,162 @@
+#pragma once
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include "gbbs/gbbs.h"
+#include "telemetry.h"
+
+// Counter-driven DAG executor: every node has a counter holding the number of
+// unfinished predecessors; a node runs once its counter reaches zero, then
+// releases its dependents. This is the loop inside every MIS variant, with
+// the dependency structure, the counter type and the task pulled out.
+//
+//   Deps     : size_t degree(uintE v) and uintE get(uintE v, size_t i), the
+//              i-th dependent of v or dag_executor::kSkip (lets a graph be
+//              used directly, e.g. "later neighbors" of the MIS priority DAG)
+//   Counter  : any counter from include/; see release() for the interfaces
+//   task     : task(v), run once when v becomes ready
+//   edge     : edge(v, w), run for every dependent before w is released
+//              (push-style data flow such as longest path)
+//
+// Scheduling is chosen at compile time:
+//   rounds : round-synchronous frontiers, like the rootset loop
+//   async  : work stealing; a finished node spawns its ready dependents
+//            directly. A single ready dependent is continued in the same
+//            frame, so chains do not grow the stack.
+// Defining DAG_EXECUTOR_ASYNC makes async the default.
+// The rounds schedule reports every frontier to telemetry (size, dependents
+// scanned, time); async has no frontiers and only fills stats.
+namespace dag_executor {
+
+using gbbs::uintE;
+
+constexpr uintE kSkip = UINT_E_MAX;
+
+enum class schedule { rounds, async };
+
+#ifdef DAG_EXECUTOR_ASYNC
+constexpr schedule kDefaultSchedule = schedule::async;
+#else
+constexpr schedule kDefaultSchedule = schedule::rounds;
+#endif
+
+// Counters whose decrement reports reaching zero exactly once
+// (deterministic_counter.h, perthread_counter.h). Others (e.g. the funnel
+// ParCounter) only expose decrement() + is_zero(), so several releasers may
+// see zero; the executor then claims the node with a flag.
+template <class C>
+concept exact_counter = requires(C c) { { c.decrement_atomic() } -> std::same_as<bool>; } ||
+                        requires(C c) { { c.decrement() } -> std::same_as<bool>; };
+
+template <class C>
+inline bool release(C& c) {
+    if constexpr (requires { { c.decrement_atomic() } -> std::same_as<bool>; }) return c.decrement_atomic();
+    else if constexpr (requires { { c.decrement() } -> std::same_as<bool>; }) return c.decrement();
+    else { c.decrement(); return c.is_zero(); }
+}
+
+template <class C>
+inline bool ready(const C& c) {
+    if constexpr (requires { { c.not_zero() } -> std::same_as<bool>; }) return !c.not_zero();
+    else return c.is_zero();
+}
+
+// Materialized dependency CSR: the dependents of v are
+// targets[offsets[v] .. offsets[v + 1]).
+struct csr_dependencies {
+    parlay::sequence<size_t> offsets;
+    parlay::sequence<uintE> targets;
+    inline size_t degree(uintE v) const { return offsets[v + 1] - offsets[v]; }
+    inline uintE get(uintE v, size_t i) const { return targets[offsets[v] + i]; }
+};
+
+struct stats {
+    size_t rounds = 0;  // frontiers processed (rounds schedule only)
+    size_t tasks = 0;
+};
+
+struct no_edge {
+    inline void operator()(uintE, uintE) const {}
+};
+
+template <schedule S = kDefaultSchedule, class Deps, class Counter, class Task, class Edge = no_edge>
+stats run(size_t n, const Deps& deps, Counter* counters, Task&& task, Edge&& edge = Edge()) {
+    stats st;
+    auto claimed = parlay::sequence<bool>(exact_counter<Counter> ? 0 : n, false);
+    // The counters decrement with relaxed ordering; the fences make v's task
+    // visible to w's task when v releases w (needed by the async schedule,
+    // where no round barrier sits between them).
+    auto try_release = [&](uintE w) {
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        if (!release(counters[w])) return false;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if constexpr (!exact_counter<Counter>) return !__atomic_test_and_set(&claimed[w], __ATOMIC_ACQ_REL);
+        return true;
+    };
+    auto roots = parlay::pack_index<uintE>(parlay::delayed_seq<bool>(n, [&](size_t v) { return ready(counters[v]); }));
+    if constexpr (!exact_counter<Counter>) parlay::parallel_for(0, roots.size(), [&](size_t i) { claimed[roots[i]] = true; });
+
+    if constexpr (S == schedule::rounds) {
+        auto frontier = std::move(roots);
+        while (frontier.size() > 0) {
+            auto start = std::chrono::steady_clock::now();
+            parlay::parallel_for(0, frontier.size(), [&](size_t i) { task(frontier[i]); });
+            auto degs = parlay::tabulate(frontier.size(), [&](size_t i) { return deps.degree(frontier[i]); });
+            size_t total = parlay::scan_inplace(degs);
+            auto out = parlay::sequence<uintE>::uninitialized(total);
+            parlay::parallel_for(0, frontier.size(), [&](size_t i) {
+                uintE v = frontier[i];
+                parlay::parallel_for(0, deps.degree(v), [&](size_t j) {
+                    uintE w = deps.get(v, j);
+                    bool fired = false;
+                    if (w != kSkip) { edge(v, w); fired = try_release(w); }
+                    out[degs[i] + j] = fired ? w : kSkip;
+                }, 2048);
+            }, 1);
+            st.tasks += frontier.size();
+            st.rounds++;
+            size_t frontier_size = frontier.size();
+            frontier = parlay::filter(out, [](uintE w) { return w != kSkip; });
+            if (telemetry::enabled())
+                telemetry::round(frontier_size, 0, total,
+                                 std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+    } else {
+        auto done = parlay::sequence<size_t>(parlay::num_workers(), 0);
+        auto process = [&](auto& self, uintE v) -> void {
+            while (true) {
+                task(v);
+                done[parlay::worker_id()]++;
+                size_t d = deps.degree(v), head = std::min<size_t>(d, 64);
+                uintE ready_buf[64];
+                size_t cnt = 0;
+                for (size_t j = 0; j < head; j++) {
+                    uintE w = deps.get(v, j);
+                    if (w == kSkip) continue;
+                    edge(v, w);
+                    if (try_release(w)) ready_buf[cnt++] = w;
+                }
+                if (head < d || cnt > 1) {
+                    parlay::par_do(
+                        [&] {
+                            parlay::parallel_for(head, d, [&](size_t k) {
+                                uintE w = deps.get(v, k);
+                                if (w == kSkip) return;
+                                edge(v, w);
+                                if (try_release(w)) self(self, w);
+                            }, 64);
+                        },
+                        [&] { parlay::parallel_for(0, cnt, [&](size_t k) { self(self, ready_buf[k]); }, 1); });
+                    return;
+                }
+                if (cnt == 0) return;
+                v = ready_buf[0];  // chain: continue in this frame
+            }
+        };
+        parlay::parallel_for(0, roots.size(), [&](size_t i) { process(process, roots[i]); }, 1);
+        for (size_t c : done) st.tasks += c;
+    }
+    return st;
+}
+
+}  // namespace dag_executor
@@ -5,6 +5,18 @@ struct Counter {
     Counter(const Counter& other): value(other.value) { }
     inline bool decrement()        noexcept { return value-- == 1; }
     inline bool decrement_atomic() noexcept { return __atomic_fetch_sub(&value, 1, __ATOMIC_RELAXED) == 1; }
+    inline bool increment()        noexcept { return value++ == 0; }
+    inline bool increment_atomic() noexcept { return __atomic_fetch_add(&value, 1, __ATOMIC_RELAXED) == 0; }
+    // 减一，从 threshold + 1 变成 threshold 的那一次返回 true (只有一次)；已经 <= threshold 时不再写
+    inline bool decrement_until(int threshold) noexcept {
+        if (value <= threshold) return false;
+        return value-- == threshold + 1;
+    }
+    inline bool decrement_until_atomic(int threshold) noexcept {
+        if (__atomic_load_n(&value, __ATOMIC_RELAXED) <= threshold) return false;
+        return __atomic_fetch_sub(&value, 1, __ATOMIC_RELAXED) == threshold + 1;
+    }
+    inline int get() const         noexcept { return __atomic_load_n(&value, __ATOMIC_RELAXED); }
     inline bool not_zero() const   noexcept { return __atomic_load_n(&value, __ATOMIC_RELAXED) != 0; }
     inline bool set_zero()         noexcept { return (value > 0) ? (value = 0, true) : false; }
     inline bool set_zero_atomic()  noexcept { return __atomic_exchange_n(&value, 0, __ATOMIC_ACQ_REL) != 0; }
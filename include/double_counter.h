@@ -117,6 +117,35 @@ struct Counter {
     {
         zero_flag.store(0, std::memory_order_release);
     }
+
+    // 减到阈值 (k-core 剥离用)，不和 decrement / is_zero 混用。值是两个分片之和；
+    // 减一随机选一个分片 (选中的已经 <= 0 时换另一个)。分片各自单调递减，所以减完之后读到的和
+    // 不会小于当时的真实值: 读到 <= threshold 说明已经跨过了阈值，最后一个减的一定读得到。
+    // 这些调用里只有第一个把 zero_flag 换成 kCrossed 的返回 true。
+    static constexpr unsigned char kCrossed = 4;
+
+    inline int get() const noexcept
+    {
+        return shard1.load(std::memory_order_seq_cst) + shard2.load(std::memory_order_seq_cst);
+    }
+
+    inline bool decrement_until(int threshold) noexcept
+    {
+        if (get() <= threshold) return false;
+        rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+        std::atomic<int>& first  = (rng & 1) ? shard1 : shard2;
+        std::atomic<int>& second = (rng & 1) ? shard2 : shard1;
+        std::atomic<int>& shard = (first.load(std::memory_order_relaxed) > 0) ? first : second;
+        shard.fetch_sub(1, std::memory_order_seq_cst);
+        if (get() > threshold) return false;
+        unsigned char flag = zero_flag.load(std::memory_order_relaxed);
+        while (flag != kCrossed) {
+            if (zero_flag.compare_exchange_weak(flag, kCrossed, std::memory_order_acq_rel, std::memory_order_relaxed)) return true;
+        }
+        return false;
+    }
+
+    inline bool decrement_until_atomic(int threshold) noexcept { return decrement_until(threshold); }
 };
 
 thread_local uint32_t Counter::rng = 0x12345678;
@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+#include "parlay/utilities.h"
+
+// Priority of an undirected edge {u, v} for greedy maximal matching: the
+// hash of the canonical pair (min << 32 | max). parlay::hash64 is a bijection
+// on 64-bit words, so distinct edges always get distinct keys and no tiebreak
+// is needed. Shared by MM/01_sequential and the parallel engines so they
+// produce the same matching.
+namespace edge_priority {
+
+inline uint64_t key(uint32_t u, uint32_t v) {
+    uint64_t packed = (u < v) ? ((uint64_t(u) << 32) | v) : ((uint64_t(v) << 32) | u);
+    return parlay::hash64(packed);
+}
+
+}  // namespace edge_priority
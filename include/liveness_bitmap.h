@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "gbbs/gbbs.h"
+
+// One bit per vertex, set while the vertex is still undecided (neither in the
+// MIS nor removed). Edge functors test it in cond() before touching the
+// counter, so edges to dead vertices are dropped from a structure of n / 8
+// bytes instead of loading the counter's cache line (4 bytes per vertex for
+// deterministic_counter.h, 12 for double_counter.h, a pointer chase for the
+// funnel and 14_test_pointer.h counters).
+//
+//   auto live = LivenessBitmap::from(n, [&](size_t v) { return counters[v].not_zero(); });
+//   live.kill(v);                  // v joined the MIS or was removed
+//   if (live.live(d)) ...          // only then look at counters[d]
+//
+// kill() is always an atomic fetch_and: neighbouring vertices share a word,
+// so even the non-atomic edgeMap update() of distinct targets may race on it.
+struct LivenessBitmap {
+    parlay::sequence<uint64_t> words;
+
+    LivenessBitmap() = default;
+
+    template <class F>
+    static LivenessBitmap from(size_t n, F is_live) {
+        LivenessBitmap b;
+        b.words = parlay::tabulate((n + 63) / 64, [&](size_t w) {
+            uint64_t word = 0;
+            size_t end = std::min(n, (w + 1) * 64);
+            for (size_t v = w * 64; v < end; v++) word |= uint64_t(is_live(v)) << (v & 63);
+            return word;
+        });
+        return b;
+    }
+
+    inline bool live(size_t v) const noexcept {
+        return (__atomic_load_n(&words[v >> 6], __ATOMIC_RELAXED) >> (v & 63)) & 1;
+    }
+    // true iff this call cleared the bit
+    inline bool kill(size_t v) noexcept {
+        uint64_t bit = uint64_t(1) << (v & 63);
+        return __atomic_fetch_and(&words[v >> 6], ~bit, __ATOMIC_RELAXED) & bit;
+    }
+
+    size_t count() const {
+        return parlay::reduce(parlay::delayed_seq<size_t>(words.size(), [&](size_t w) {
+            return size_t(__builtin_popcountll(words[w]));
+        }));
+    }
+    size_t bytes() const { return words.size() * sizeof(uint64_t); }
+};
+
+// Per-worker tally of the counter accesses a bitmap test saved, summed and
+// reset once per round on the main thread.
+struct FilterTally {
+    struct alignas(64) slot { size_t v = 0; };
+    std::vector<slot> slots;
+
+    FilterTally() : slots(parlay::num_workers()) {}
+    inline void add() noexcept { slots[parlay::worker_id()].v++; }
+    size_t take() {
+        size_t total = 0;
+        for (auto& s : slots) { total += s.v; s.v = 0; }
+        return total;
+    }
+};
@@ -0,0 +1,140 @@
+#pragma once
+#include <fcntl.h>
+#include <malloc.h>
+#include <unistd.h>
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "gbbs/gbbs.h"
+#include "telemetry.h"
+
+// Memory accounting for the MIS engines: explicit registration of the bytes
+// of every structure, plus resident-set checkpoints per phase.
+//
+//   if (mem_stats::enabled()) mem_stats::add("counters", mem_stats::counter_bytes(counters));
+//   mem_stats::checkpoint("init");     // VmRSS now, VmHWM since last checkpoint
+//   mem_stats::report(n);              // prints, forwards to telemetry, resets
+//
+// Off unless the runner enables it (-mem): counting the heap of pointer
+// counters is an O(n) pass and would otherwise land in the timed region.
+//
+// Counters that keep their state behind a pointer (14_test_pointer.h, the
+// funnel ParCounter in concurrent_counter.h) are charged malloc_usable_size
+// of the pointee on top of the array itself. For the funnel counter that is
+// the top-level object only; its internal per-thread slots are not visible
+// from here, so treat the number as a lower bound.
+//
+// Per-phase high-water marks reset the kernel's peak RSS by writing 5 to
+// /proc/self/clear_refs (Linux 4.0+); where that is not permitted the value
+// is the process peak so far.
+namespace mem_stats {
+
+struct entry {
+    std::string name;
+    size_t bytes;
+};
+
+struct phase_sample {
+    std::string name;
+    size_t rss_kb, hwm_kb;
+};
+
+struct registry {
+    bool enabled = false;
+    std::vector<entry> entries;
+    std::vector<phase_sample> phases;
+    size_t peak_kb = 0;
+};
+
+inline registry& global() {
+    static registry r;
+    return r;
+}
+
+inline void enable(bool on) { global().enabled = on; }
+inline bool enabled() { return global().enabled; }
+
+inline void add(const std::string& name, size_t bytes) { global().entries.push_back({name, bytes}); }
+
+template <class Seq>
+inline size_t bytes(const Seq& s) { return s.size() * sizeof(s[0]); }
+
+template <class Graph>
+inline size_t graph_bytes(const Graph& G) { return G.n * sizeof(*G.v_data) + G.m * sizeof(*G.e0); }
+
+// heap memory owned by one counter
+template <class C>
+inline size_t heap_bytes(const C& c) {
+    if constexpr (requires { { c.value } -> std::convertible_to<const void*>; })
+        return c.value ? malloc_usable_size(const_cast<void*>(static_cast<const void*>(c.value))) : 0;
+    else
+        return 0;
+}
+
+template <class Seq>
+inline size_t counter_bytes(const Seq& counters) {
+    using C = std::decay_t<decltype(counters[0])>;
+    size_t inline_bytes = counters.size() * sizeof(C);
+    if constexpr (requires(const C& c) { { c.value } -> std::convertible_to<const void*>; })
+        return inline_bytes + parlay::reduce(parlay::delayed_seq<size_t>(counters.size(), [&](size_t i) {
+            return heap_bytes(counters[i]);
+        }));
+    else
+        return inline_bytes;
+}
+
+// VmRSS / VmHWM from /proc/self/status, in kB
+inline size_t status_kb(const char* key) {
+    std::ifstream in("/proc/self/status");
+    std::string line;
+    size_t len = std::char_traits<char>::length(key);
+    while (std::getline(in, line))
+        if (line.compare(0, len, key) == 0) return std::stoull(line.substr(len + 1));
+    return 0;
+}
+
+inline void reset_peak() {
+    int fd = open("/proc/self/clear_refs", O_WRONLY);
+    if (fd < 0) return;
+    ssize_t r = write(fd, "5", 1);
+    (void)r;
+    close(fd);
+}
+
+inline void checkpoint(const std::string& name) {
+    auto& r = global();
+    if (!r.enabled) return;
+    size_t hwm = status_kb("VmHWM");
+    r.phases.push_back({name, status_kb("VmRSS"), hwm});
+    r.peak_kb = std::max(r.peak_kb, hwm);
+    reset_peak();
+}
+
+inline void report(size_t n) {
+    auto& r = global();
+    if (!r.enabled) return;
+    size_t total = 0;
+    for (const auto& e : r.entries) {
+        total += e.bytes;
+        std::cout << "## Memory " << e.name << " = " << e.bytes << " bytes ("
+                  << (n ? double(e.bytes) / n : 0.0) << " bytes/vertex)" << std::endl;
+        telemetry::metric("bytes " + e.name, e.bytes);
+    }
+    std::cout << "## Memory tracked total = " << total << " bytes" << std::endl;
+    telemetry::metric("bytes tracked total", total);
+    for (const auto& p : r.phases) {
+        std::cout << "## Memory phase " << p.name << " rss = " << p.rss_kb << " kB peak = " << p.hwm_kb << " kB" << std::endl;
+        telemetry::metric("peak kB " + p.name, p.hwm_kb);
+    }
+    std::cout << "## Peak RSS = " << r.peak_kb << " kB" << std::endl;
+    telemetry::metric("peak RSS kB", r.peak_kb);
+    r = registry();
+    r.enabled = true;
+}
+
+}  // namespace mem_stats
@@ -8,6 +8,12 @@ struct Counter {
     Counter(int value_) : value(value_) {}
     Counter(const Counter& other) : value(other.value){}
     inline bool decrement() noexcept { return gbbs::fetch_and_add(&value, -1) == 1; }
+    inline bool decrement_until(int threshold) noexcept {
+        if (value <= threshold) return false;
+        return gbbs::fetch_and_add(&value, -1) == threshold + 1;
+    }
+    inline bool decrement_until_atomic(int threshold) noexcept { return decrement_until(threshold); }
+    inline int get() const noexcept { return __atomic_load_n(&value, __ATOMIC_RELAXED); }
     inline bool is_zero() const noexcept { return value == 0; }
     inline bool set_zero() noexcept { 
         auto v = value;
@@ -0,0 +1,341 @@
+#pragma once
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "gbbs/gbbs.h"
+
+// Explicit page placement for the MIS engine's per-vertex arrays.
+//   first_touch : whatever the kernel does (the default everywhere else)
+//   interleave  : pages round-robin over all NUMA nodes
+//   block       : vertex range split into one contiguous block per node, and
+//                 workers pinned so worker w runs on node w * nodes / workers
+// mbind is called through syscall() so no libnuma is needed at link time;
+// place() returns the errno of the first failing call so runners can report it.
+//
+// "block" is a memory placement only. Pinning spreads the workers evenly over
+// the nodes, but parlay's scheduler steals work freely, so nothing makes the
+// workers of a node process the vertices whose block lives there; the block
+// policy bounds where pages live, not which thread touches them.
+//
+// Orthogonally, the pages can be 2MB huge pages:
+//   small   : 4KB pages
+//   thp     : 2MB-aligned mapping + madvise(MADV_HUGEPAGE); falls back to
+//             hugetlbfs if transparent huge pages are disabled
+//   hugetlb : explicit MAP_HUGETLB from the reserved pool (vm.nr_hugepages);
+//             falls back to thp if the pool is too small
+namespace placement {
+
+enum class numa_policy { first_touch, interleave, block };
+
+inline numa_policy parse_numa_policy(const std::string& s) {
+    if (s == "interleave") return numa_policy::interleave;
+    if (s == "block") return numa_policy::block;
+    return numa_policy::first_touch;
+}
+
+inline const char* to_string(numa_policy p) {
+    switch (p) {
+        case numa_policy::interleave: return "interleave";
+        case numa_policy::block: return "block";
+        default: return "first_touch";
+    }
+}
+
+enum class page_mode { small, thp, hugetlb };
+
+inline page_mode parse_page_mode(const std::string& s) {
+    if (s == "thp") return page_mode::thp;
+    if (s == "hugetlb") return page_mode::hugetlb;
+    return page_mode::small;
+}
+
+inline const char* to_string(page_mode m) {
+    switch (m) {
+        case page_mode::thp: return "thp";
+        case page_mode::hugetlb: return "hugetlb";
+        default: return "small";
+    }
+}
+
+constexpr size_t kHugePage = size_t(1) << 21;
+constexpr int kMadvCollapse = 25;  // MADV_COLLAPSE, Linux 6.1+
+
+constexpr int kMpolBind = 2;
+constexpr int kMpolInterleave = 3;
+constexpr unsigned kMpolMfMove = 1 << 1;
+
+// cpus of every NUMA node, from sysfs; a single node with all cpus if absent
+inline const std::vector<std::vector<int>>& node_cpus() {
+    static std::vector<std::vector<int>> nodes = [] {
+        std::vector<std::vector<int>> res;
+        for (int node = 0;; node++) {
+            std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!in.is_open()) break;
+            std::string list; std::getline(in, list);
+            std::vector<int> cpus;
+            size_t pos = 0;
+            while (pos < list.size()) {
+                size_t comma = list.find(',', pos); if (comma == std::string::npos) comma = list.size();
+                std::string range = list.substr(pos, comma - pos);
+                size_t dash = range.find('-');
+                int lo = std::stoi(range.substr(0, dash));
+                int hi = (dash == std::string::npos) ? lo : std::stoi(range.substr(dash + 1));
+                for (int c = lo; c <= hi; c++) cpus.push_back(c);
+                pos = comma + 1;
+            }
+            res.push_back(cpus);
+        }
+        if (res.empty()) {
+            std::vector<int> cpus;
+            for (int c = 0; c < sysconf(_SC_NPROCESSORS_ONLN); c++) cpus.push_back(c);
+            res.push_back(cpus);
+        }
+        return res;
+    }();
+    return nodes;
+}
+
+inline int num_nodes() { return static_cast<int>(node_cpus().size()); }
+
+inline long mbind(void* addr, size_t len, int mode, uint64_t nodemask, unsigned flags) {
+    return syscall(SYS_mbind, addr, len, mode, &nodemask, sizeof(nodemask) * 8, flags);
+}
+
+inline uint64_t all_nodes_mask() { return (num_nodes() >= 64) ? ~0ull : ((1ull << num_nodes()) - 1); }
+
+// Applies the policy to [addr, addr + len). With flags = kMpolMfMove, pages
+// that are already resident are migrated too (used for the graph arrays).
+// On a hugetlb mapping every range passed to mbind must be 2MB-aligned, so
+// the range and the per-node blocks are cut in huge pages there.
+// Returns 0, or the errno of the first mbind that failed.
+inline int place(void* addr, size_t len, numa_policy p, unsigned flags = 0, page_mode m = page_mode::small) {
+    if (p == numa_policy::first_touch || num_nodes() < 2 || len == 0) return 0;
+    size_t page = (m == page_mode::hugetlb) ? kHugePage : sysconf(_SC_PAGESIZE);
+    uintptr_t lo = reinterpret_cast<uintptr_t>(addr) & ~(page - 1);
+    uintptr_t hi = (reinterpret_cast<uintptr_t>(addr) + len + page - 1) & ~(page - 1);
+    if (p == numa_policy::interleave)
+        return (mbind(reinterpret_cast<void*>(lo), hi - lo, kMpolInterleave, all_nodes_mask(), flags) == 0) ? 0 : errno;
+    size_t nodes = num_nodes();
+    size_t chunk = ((hi - lo) / nodes + page - 1) & ~(page - 1);
+    int err = 0;
+    for (size_t node = 0; node < nodes; node++) {
+        uintptr_t b = lo + node * chunk, e = std::min<uintptr_t>(hi, b + chunk);
+        if (b < e && mbind(reinterpret_cast<void*>(b), e - b, kMpolBind, 1ull << node, flags) != 0 && !err) err = errno;
+    }
+    return err;
+}
+
+inline void report_place(const char* what, int err) {
+    if (err) std::cout << "## mbind " << what << " failed: " << std::strerror(err) << std::endl;
+}
+
+inline bool thp_enabled() {
+    std::ifstream in("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string line; std::getline(in, line);
+    return in.is_open() && line.find("[never]") == std::string::npos;
+}
+
+// Asks for huge pages on the 2MB-aligned interior of memory that is already
+// allocated (the graph arrays). MADV_COLLAPSE makes it synchronous where the
+// kernel supports it; otherwise khugepaged collapses the range eventually.
+inline void advise_huge(void* addr, size_t len) {
+    uintptr_t lo = (reinterpret_cast<uintptr_t>(addr) + kHugePage - 1) & ~(kHugePage - 1);
+    uintptr_t hi = (reinterpret_cast<uintptr_t>(addr) + len) & ~(kHugePage - 1);
+    if (lo >= hi) return;
+    madvise(reinterpret_cast<void*>(lo), hi - lo, MADV_HUGEPAGE);
+    madvise(reinterpret_cast<void*>(lo), hi - lo, kMadvCollapse);
+}
+
+// kB of [addr, addr + len) currently backed by huge pages (AnonHugePages for
+// THP, Private_Hugetlb for hugetlbfs), summed over the mappings in
+// /proc/self/smaps that overlap the range.
+inline size_t huge_kb(const void* addr, size_t len) {
+    std::ifstream in("/proc/self/smaps");
+    uintptr_t lo = reinterpret_cast<uintptr_t>(addr), hi = lo + len;
+    std::string line;
+    bool inside = false;
+    size_t kb = 0;
+    while (std::getline(in, line)) {
+        size_t dash = line.find('-');
+        if (dash != std::string::npos && dash < 17 && line.find(':') > line.find(' ')) {
+            uintptr_t b = std::stoull(line.substr(0, dash), nullptr, 16);
+            uintptr_t e = std::stoull(line.substr(dash + 1), nullptr, 16);
+            inside = b < hi && lo < e;
+        } else if (inside && (line.rfind("AnonHugePages:", 0) == 0 || line.rfind("Private_Hugetlb:", 0) == 0)) {
+            kb += std::stoull(line.substr(line.find(':') + 1));
+        }
+    }
+    return kb;
+}
+
+// AnonHugePages of the whole process, from /proc/self/smaps_rollup.
+inline size_t process_anon_huge_kb() {
+    std::ifstream in("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(in, line))
+        if (line.rfind("AnonHugePages:", 0) == 0) return std::stoull(line.substr(line.find(':') + 1));
+    return 0;
+}
+
+// Fixed-size array of T backed by its own anonymous mapping, so the placement
+// and page size are in place before the first touch.
+template <class T>
+struct vertex_array {
+    T* data = nullptr;
+    size_t n = 0;
+    size_t bytes = 0;
+    void* base = nullptr;      // the mapping, which for thp is larger than bytes
+    size_t mapped = 0;
+    page_mode mode = page_mode::small;
+    int place_error = 0;       // errno of the failed mbind, 0 if placed (or nothing to do)
+    vertex_array() = default;
+    vertex_array(size_t n_, numa_policy p, page_mode m = page_mode::small)
+        : n(n_), bytes(std::max<size_t>(n_ * sizeof(T), 1)) {
+        if (m == page_mode::thp && !thp_enabled()) m = page_mode::hugetlb;
+        if (m == page_mode::hugetlb && !map_hugetlb()) m = thp_enabled() ? page_mode::thp : page_mode::small;
+        if (m == page_mode::thp) map_thp();
+        if (m == page_mode::small) map_small();
+        mode = m;
+        place_error = (m == page_mode::hugetlb) ? place(base, mapped, p, 0, m) : place(data, bytes, p);
+    }
+    template <class F>
+    vertex_array(size_t n_, numa_policy p, F f) : vertex_array(n_, p, page_mode::small, f) {}
+    template <class F>
+    vertex_array(size_t n_, numa_policy p, page_mode m, F f) : vertex_array(n_, p, m) {
+        parlay::parallel_for(0, n, [&](size_t i) { new (data + i) T(f(i)); });
+    }
+    vertex_array(const vertex_array&) = delete;
+    vertex_array& operator=(const vertex_array&) = delete;
+    ~vertex_array() {
+        if (!data) return;
+        if constexpr (!std::is_trivially_destructible_v<T>) parlay::parallel_for(0, n, [&](size_t i) { data[i].~T(); });
+        munmap(base, mapped);
+    }
+    inline T& operator[](size_t i) { return data[i]; }
+    inline const T& operator[](size_t i) const { return data[i]; }
+    inline T* begin() { return data; }
+    inline size_t size() const { return n; }
+    inline size_t huge_kb() const { return placement::huge_kb(data, bytes); }
+
+ private:
+    static size_t round_huge(size_t x) { return (x + kHugePage - 1) & ~(kHugePage - 1); }
+    void map_small() {
+        mapped = bytes;
+        base = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) throw std::bad_alloc();
+        data = static_cast<T*>(base);
+    }
+    // over-allocates by one huge page and aligns data to 2MB inside it
+    void map_thp() {
+        mapped = round_huge(bytes) + kHugePage;
+        base = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) throw std::bad_alloc();
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(base) + kHugePage - 1) & ~(kHugePage - 1);
+        data = reinterpret_cast<T*>(aligned);
+        madvise(data, round_huge(bytes), MADV_HUGEPAGE);
+    }
+    bool map_hugetlb() {
+        mapped = round_huge(bytes);
+        base = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (base == MAP_FAILED) return false;
+        data = static_cast<T*>(base);
+        return true;
+    }
+};
+
+// Hardware counters summed over the workers: node-loads / node-load-misses
+// (local vs remote DRAM reads) and dTLB read misses.
+struct hw_counts {
+    uint64_t node_loads = 0;
+    uint64_t node_misses = 0;
+    uint64_t dtlb_misses = 0;
+};
+
+// Per-worker hardware counters plus the pinning for the block policy. Both
+// are per-thread state, so they are set up by letting every worker claim its
+// slot inside one parallel loop. The scheduler does not guarantee that every
+// worker runs a task there: such workers keep no counters and no pinning, and
+// covered / pinned say how many were actually set up.
+struct worker_setup {
+    std::vector<int> loads_fd, misses_fd, dtlb_fd;
+    size_t covered = 0;
+    size_t pinned = 0;
+
+    static int open_counter(uint64_t cache, uint64_t result) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    explicit worker_setup(numa_policy p) {
+        size_t workers = parlay::num_workers();
+        loads_fd.assign(workers, -2);
+        misses_fd.assign(workers, -2);
+        dtlb_fd.assign(workers, -2);
+        parlay::parallel_for(0, workers * 256, [&](size_t) {
+            size_t w = parlay::worker_id();
+            if (!__sync_bool_compare_and_swap(&loads_fd[w], -2, -1)) return;
+            if (p == numa_policy::block) {
+                const auto& cpus = node_cpus()[w * num_nodes() / workers];
+                cpu_set_t set; CPU_ZERO(&set);
+                for (int c : cpus) CPU_SET(c, &set);
+                if (sched_setaffinity(0, sizeof(set), &set) == 0) __sync_fetch_and_add(&pinned, 1);
+            }
+            loads_fd[w] = open_counter(PERF_COUNT_HW_CACHE_NODE, PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+            misses_fd[w] = open_counter(PERF_COUNT_HW_CACHE_NODE, PERF_COUNT_HW_CACHE_RESULT_MISS);
+            dtlb_fd[w] = open_counter(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_RESULT_MISS);
+            __sync_fetch_and_add(&covered, 1);
+        }, 1);
+    }
+    ~worker_setup() {
+        for (auto* fds : {&loads_fd, &misses_fd, &dtlb_fd})
+            for (int fd : *fds) if (fd >= 0) close(fd);
+    }
+
+    bool numa_available() const {
+        for (int fd : loads_fd) if (fd >= 0) return true;
+        return false;
+    }
+    bool dtlb_available() const {
+        for (int fd : dtlb_fd) if (fd >= 0) return true;
+        return false;
+    }
+    void start() {
+        for (auto* fds : {&loads_fd, &misses_fd, &dtlb_fd})
+            for (int fd : *fds) if (fd >= 0) { ioctl(fd, PERF_EVENT_IOC_RESET, 0); ioctl(fd, PERF_EVENT_IOC_ENABLE, 0); }
+    }
+    // counts since start()
+    hw_counts stop() {
+        auto sum = [](std::vector<int>& fds) {
+            uint64_t total = 0;
+            for (int fd : fds) {
+                uint64_t v = 0;
+                if (fd >= 0) { ioctl(fd, PERF_EVENT_IOC_DISABLE, 0); if (read(fd, &v, sizeof(v)) == sizeof(v)) total += v; }
+            }
+            return total;
+        };
+        hw_counts c;
+        c.node_loads = sum(loads_fd);
+        c.node_misses = sum(misses_fd);
+        c.dtlb_misses = sum(dtlb_fd);
+        return c;
+    }
+};
+
+}  // namespace placement
@@ -0,0 +1,51 @@
+#pragma once
+#include <algorithm>
+#include "gbbs/gbbs.h"
+
+namespace gbbs {
+
+// Sparse edgeMap that walks every adjacency list in batches of K edges. The
+// targets of batch i + 1 are prefetched (f.prefetch(d)) before batch i is
+// applied, so the random loads of per-vertex state overlap instead of
+// stalling one edge at a time. F needs cond, updateAtomic and prefetch.
+template <class Graph, class F>
+inline vertexSubset prefetch_edge_map(Graph& G, vertexSubset& vs, F f, size_t K) {
+    constexpr size_t kBlock = 4096;  // 大度数点的邻接表按块并行
+    size_t n = G.n;
+    K = std::max<size_t>(K, 1);
+    vs.toSparse();
+    size_t k = vs.size();
+    if (k == 0) return vertexSubset(n);
+
+    auto offsets = parlay::tabulate<size_t>(k, [&](size_t i) {
+        return static_cast<size_t>(G.get_vertex(vs.vtx(i)).out_neighbors().get_degree());
+    });
+    size_t total = parlay::scan_inplace(offsets);
+    auto out = sequence<uintE>::uninitialized(total);
+
+    parallel_for(0, k, [&](size_t i) {
+        uintE s = vs.vtx(i);
+        auto nghs = G.get_vertex(s).out_neighbors();
+        auto* e = nghs.get_edges();
+        size_t deg = nghs.get_degree();
+        uintE* o = out.begin() + offsets[i];
+        auto run = [&](size_t lo, size_t hi) {
+            for (size_t j = lo; j < std::min(hi, lo + K); j++) f.prefetch(std::get<0>(e[j]));
+            for (size_t b = lo; b < hi; b += K) {
+                size_t end = std::min(hi, b + K);
+                for (size_t j = end; j < std::min(hi, end + K); j++) f.prefetch(std::get<0>(e[j]));
+                for (size_t j = b; j < end; j++) {
+                    uintE d = std::get<0>(e[j]);
+                    o[j] = (f.cond(d) && f.updateAtomic(s, d, std::get<1>(e[j]))) ? d : UINT_E_MAX;
+                }
+            }
+        };
+        if (deg <= kBlock) { run(0, deg); }
+        else { parallel_for(0, (deg + kBlock - 1) / kBlock, [&](size_t b) { run(b * kBlock, std::min(deg, (b + 1) * kBlock)); }, 1); }
+    }, 1);
+
+    auto next = parlay::filter(out, [](uintE v) { return v != UINT_E_MAX; });
+    return vertexSubset(n, std::move(next));
+}
+
+}  // namespace gbbs
@@ -0,0 +1,132 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "gbbs/gbbs.h"
+
+// Priority policies for the MIS engine. A policy is a strict total order on
+// vertices, queried as pri.before(u, v) ("u is decided before v"), and is
+// built inside the timed initialization as Policy::build(G, seed).
+//   permutation : the materialized parlay::random_permutation every variant
+//                 uses (n uintE of memory, two random reads per edge);
+//                 ignores the seed, like the other variants
+//   hashed      : computed on the fly from hash32(v ^ seed) with the vertex id
+//                 as tiebreak, the same order as hash_lt in
+//                 04_baseline_spec_for but seedable; no memory at all
+//   degree      : ascending degree, ties broken by the seeded hash
+//   kcore       : approximate degeneracy order (peeling round, then hash)
+// degree and kcore are materialized as a rank array like permutation.
+namespace priority {
+
+using gbbs::uintE;
+
+inline uint32_t salt_of(uint64_t seed) { return static_cast<uint32_t>(parlay::hash64(seed)); }
+
+// rank[v] = position of v when the vertices are sorted by key(v) (stable, so
+// equal keys fall back to the vertex id)
+template <class Key>
+parlay::sequence<uintE> ranks_from_keys(size_t n, Key key) {
+    auto order = parlay::integer_sort(parlay::tabulate(n, [](size_t i) { return static_cast<uintE>(i); }),
+                                      [&](uintE v) { return key(v); });
+    auto rank = parlay::sequence<uintE>::uninitialized(n);
+    parlay::parallel_for(0, n, [&](size_t i) { rank[order[i]] = i; });
+    return rank;
+}
+
+struct permutation {
+    parlay::sequence<uintE> rank;
+    template <class Graph>
+    static permutation build(Graph& G, uint64_t) { return permutation{parlay::random_permutation<uintE>(G.n)}; }
+    inline bool before(uintE u, uintE v) const { return rank[u] < rank[v]; }
+    size_t bytes() const { return rank.size() * sizeof(uintE); }
+    static const char* name() { return "perm"; }
+};
+
+struct hashed {
+    uint32_t salt;
+    template <class Graph>
+    static hashed build(Graph&, uint64_t seed) { return hashed{salt_of(seed)}; }
+    inline uint64_t key(uintE v) const { return (uint64_t(parlay::hash32(v ^ salt)) << 32) | v; }
+    inline bool before(uintE u, uintE v) const { return key(u) < key(v); }
+    size_t bytes() const { return 0; }
+    static const char* name() { return "hash"; }
+};
+
+struct degree {
+    parlay::sequence<uintE> rank;
+    template <class Graph>
+    static degree build(Graph& G, uint64_t seed) {
+        uint32_t salt = salt_of(seed);
+        return degree{ranks_from_keys(G.n, [&](uintE v) {
+            uint64_t d = std::min<uint64_t>(G.get_vertex(v).out_neighbors().get_degree(), UINT32_MAX);
+            return (d << 32) | parlay::hash32(v ^ salt);
+        })};
+    }
+    inline bool before(uintE u, uintE v) const { return rank[u] < rank[v]; }
+    size_t bytes() const { return rank.size() * sizeof(uintE); }
+    static const char* name() { return "degree"; }
+};
+
+// Approximate k-core peeling: with threshold k, every live vertex whose
+// remaining degree is <= k is peeled in the same round; when nothing is left
+// to peel, k grows to max(k + 1, (1 + eps) * k). Vertices are ordered by the
+// round that peeled them, so low-core vertices come first. Since k grows
+// geometrically there are O(log_{1+eps} max degree) thresholds instead of one
+// per core value.
+//
+// The rounds under one threshold are driven by a frontier: only the
+// neighbors of the vertices just peeled are re-checked, and a neighbor joins
+// the next round when its decrement crosses k. The remaining vertices are
+// scanned once per threshold, so the peel is O(m + n * thresholds) work.
+struct kcore {
+    parlay::sequence<uintE> rank;
+    size_t peel_rounds = 0;
+    template <class Graph>
+    static kcore build(Graph& G, uint64_t seed, double eps = 0.5) {
+        using W = typename Graph::weight_type;
+        size_t n = G.n;
+        auto deg = parlay::tabulate(n, [&](size_t i) { return static_cast<int64_t>(G.get_vertex(i).out_neighbors().get_degree()); });
+        auto level = parlay::sequence<uintE>(n, 0);
+        auto removed = parlay::sequence<bool>(n, false);
+        auto alive = parlay::tabulate(n, [](size_t i) { return static_cast<uintE>(i); });
+        int64_t k = 1;
+        uintE round = 0;
+        auto peel = parlay::filter(alive, [&](uintE v) { return deg[v] <= k; });
+        while (true) {
+            if (peel.size() == 0) {
+                alive = parlay::filter(alive, [&](uintE v) { return !removed[v]; });
+                if (alive.size() == 0) break;
+                k = std::max<int64_t>(k + 1, static_cast<int64_t>(k * (1 + eps)));
+                peel = parlay::filter(alive, [&](uintE v) { return deg[v] <= k; });
+                continue;
+            }
+            parlay::parallel_for(0, peel.size(), [&](size_t i) { removed[peel[i]] = true; level[peel[i]] = round; });
+            auto offsets = parlay::tabulate(peel.size() + 1, [&](size_t i) -> size_t {
+                return (i == peel.size()) ? 0 : G.get_vertex(peel[i]).out_neighbors().get_degree();
+            });
+            size_t total = parlay::scan_inplace(offsets);
+            auto next = parlay::sequence<uintE>::uninitialized(total);
+            parlay::parallel_for(0, peel.size(), [&](size_t i) {
+                size_t j = offsets[i];
+                G.get_vertex(peel[i]).out_neighbors().map([&](uintE src, uintE ngh, const W&) {
+                    uintE out = UINT_E_MAX;
+                    if (!removed[ngh]) {
+                        int64_t old = __atomic_fetch_sub(&deg[ngh], 1, __ATOMIC_RELAXED);
+                        if (old == k + 1) out = ngh;   // exactly one decrement crosses k
+                    }
+                    next[j++] = out;
+                }, false);
+            }, 1);
+            peel = parlay::filter(next, [](uintE v) { return v != UINT_E_MAX; });
+            round++;
+        }
+        uint32_t salt = salt_of(seed);
+        kcore res{ranks_from_keys(n, [&](uintE v) { return (uint64_t(level[v]) << 32) | parlay::hash32(v ^ salt); })};
+        res.peel_rounds = round;
+        return res;
+    }
+    inline bool before(uintE u, uintE v) const { return rank[u] < rank[v]; }
+    size_t bytes() const { return rank.size() * sizeof(uintE); }
+    static const char* name() { return "kcore"; }
+};
+
+}  // namespace priority
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+
+// Counter and vertex state in one word: the high bit means "removed", the
+// low 31 bits count the earlier neighbors that are still undecided.
+//   undecided : removed bit clear, count > 0
+//   root / MIS: word == 0
+//   removed   : removed bit set (the count underneath is kept but unused)
+// Removal is a single fetch_or and a decrement a single fetch_sub; the value
+// they return says what happened, so the edge functors need no
+// check-then-act sequence (load, then exchange) on the counter.
+struct StateCounter {
+    static constexpr uint32_t kRemoved = 1u << 31;
+    enum class result { pending, zero, removed };
+
+    uint32_t word;
+    StateCounter(int value_) : word(static_cast<uint32_t>(value_)) {}
+    StateCounter(const StateCounter& other) : word(other.word) {}
+
+    // true iff this call removed an undecided vertex (once per vertex)
+    inline bool remove()        noexcept { uint32_t old = word; word |= kRemoved; return !(old & kRemoved) && old != 0; }
+    inline bool remove_atomic() noexcept {
+        uint32_t old = __atomic_fetch_or(&word, kRemoved, __ATOMIC_RELAXED);
+        return !(old & kRemoved) && old != 0;
+    }
+    // An earlier neighbor was removed. The count of a removed vertex only
+    // drops by its own earlier neighbors, so it never borrows into the high bit.
+    inline result decrement()        noexcept { return classify(word--); }
+    inline result decrement_atomic() noexcept { return classify(__atomic_fetch_sub(&word, 1, __ATOMIC_RELAXED)); }
+
+    inline bool undecided() const noexcept {
+        uint32_t w = __atomic_load_n(&word, __ATOMIC_RELAXED);
+        return w != 0 && !(w & kRemoved);
+    }
+    inline bool is_zero() const noexcept { return __atomic_load_n(&word, __ATOMIC_RELAXED) == 0; }
+
+ private:
+    static inline result classify(uint32_t old) noexcept {
+        if (old & kRemoved) return result::removed;
+        return (old == 1) ? result::zero : result::pending;
+    }
+};
@@ -0,0 +1,194 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gbbs/gbbs.h"
+
+// Machine-readable run records, so scripts no longer scrape "## round = ..."
+// lines. The engines report init time and per-round frontier / removed /
+// edges traversed / time next to their existing prints; the runner closes a
+// repetition with finish() and rewrites the JSON file after each one, so the
+// file always holds every repetition of the process (gbbs -rounds N).
+//
+// Recording is off unless the runner enables it (-json <path>), so the
+// default build prints and measures exactly what it did before. The edge
+// counts for the records are taken outside the round timers through
+// untimed(), and finish() subtracts that time from the repetition's total,
+// since the runner's timer still covers it.
+//
+// Summary statistics skip the first repetition when there is more than one
+// (it is the cold warm-up run, which run.py always dropped).
+namespace telemetry {
+
+struct round_record {
+    size_t frontier;  // roots of the round
+    size_t removed;   // vertices removed by the roots
+    size_t edges;     // adjacency entries scanned (degrees of roots + removed)
+    double time;
+};
+
+struct run_record {
+    double init_time = 0.0;
+    double total_time = 0.0;
+    double untimed = 0.0;     // time spent in untimed() during this repetition
+    std::vector<round_record> rounds;
+    std::vector<std::pair<std::string, double>> metrics;  // named per-run values, e.g. memory
+};
+
+struct meta {
+    std::string graph;
+    std::string variant;
+    size_t n, m, threads;
+    uint64_t seed;
+};
+
+struct recorder {
+    bool enabled = false;
+    run_record current;
+    std::vector<run_record> runs;
+};
+
+inline recorder& global() {
+    static recorder r;
+    return r;
+}
+
+inline void enable(bool on) { global().enabled = on; }
+inline bool enabled() { return global().enabled; }
+
+inline void init(double t) {
+    if (enabled()) global().current.init_time = t;
+}
+
+inline void round(size_t frontier, size_t removed, size_t edges, double t) {
+    if (enabled()) global().current.rounds.push_back({frontier, removed, edges, t});
+}
+
+inline void metric(const std::string& name, double v) {
+    if (enabled()) global().current.metrics.emplace_back(name, v);
+}
+
+// Runs f (bookkeeping for the record) and charges its time to the current
+// repetition, so finish() can take it back out of the total.
+template <class F>
+inline auto untimed(F f) {
+    auto start = std::chrono::steady_clock::now();
+    auto res = f();
+    global().current.untimed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+// Sum of the degrees of a vertexSubset, in whichever representation it is
+// in (the subset is not converted). Engines that need it for a decision use
+// this directly.
+template <class Graph, class VS>
+inline size_t degree_sum(Graph& G, VS& vs) {
+    if (vs.size() == 0) return 0;
+    if (vs.dense()) {
+        return parlay::reduce(parlay::delayed_seq<size_t>(G.n, [&](size_t v) {
+            return vs.isIn(v) ? G.get_vertex(v).out_neighbors().get_degree() : 0;
+        }));
+    }
+    return parlay::reduce(parlay::delayed_seq<size_t>(vs.size(), [&](size_t i) {
+        return G.get_vertex(vs.vtx(i)).out_neighbors().get_degree();
+    }));
+}
+
+// degree_sum for the record, outside the timed work
+template <class Graph, class VS>
+inline size_t edges(Graph& G, VS& vs) {
+    return untimed([&] { return degree_sum(G, vs); });
+}
+
+inline void finish(double total) {
+    auto& r = global();
+    if (!r.enabled) return;
+    r.current.total_time = total - r.current.untimed;
+    r.runs.push_back(std::move(r.current));
+    r.current = run_record();
+}
+
+struct summary {
+    double median = 0, min = 0, mean = 0, ci95 = 0;  // ci95: half-width of the 95% interval of the mean
+};
+
+inline summary summarize(std::vector<double> xs) {
+    summary s;
+    if (xs.empty()) return s;
+    std::sort(xs.begin(), xs.end());
+    size_t k = xs.size();
+    s.min = xs[0];
+    s.median = (k % 2) ? xs[k / 2] : (xs[k / 2 - 1] + xs[k / 2]) / 2;
+    for (double x : xs) s.mean += x;
+    s.mean /= k;
+    if (k > 1) {
+        double var = 0;
+        for (double x : xs) var += (x - s.mean) * (x - s.mean);
+        var /= (k - 1);
+        // two-sided Student t quantile for k - 1 degrees of freedom
+        static const double t[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+        double q = (k - 1 <= 30) ? t[k - 2] : 1.96;
+        s.ci95 = q * std::sqrt(var / k);
+    }
+    return s;
+}
+
+inline std::string quote(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+inline void write_summary(std::ostream& out, const char* name, const summary& s) {
+    out << quote(name) << ": {\"median\": " << s.median << ", \"min\": " << s.min
+        << ", \"mean\": " << s.mean << ", \"ci95\": " << s.ci95 << "}";
+}
+
+inline std::string to_json(const meta& m) {
+    const auto& runs = global().runs;
+    size_t first = (runs.size() > 1) ? 1 : 0;
+    std::vector<double> total, init;
+    for (size_t i = first; i < runs.size(); i++) { total.push_back(runs[i].total_time); init.push_back(runs[i].init_time); }
+    std::ostringstream out;
+    out.precision(15);
+    out << "{\"graph\": " << quote(m.graph) << ", \"variant\": " << quote(m.variant)
+        << ", \"n\": " << m.n << ", \"m\": " << m.m << ", \"threads\": " << m.threads << ", \"seed\": " << m.seed
+        << ", \"repetitions\": " << runs.size() << ", \"warmup\": " << first << ",\n \"summary\": {";
+    write_summary(out, "time", summarize(total));
+    out << ", ";
+    write_summary(out, "init", summarize(init));
+    out << "},\n \"runs\": [";
+    for (size_t i = 0; i < runs.size(); i++) {
+        const auto& r = runs[i];
+        out << (i ? ",\n  " : "\n  ") << "{\"time\": " << r.total_time << ", \"init\": " << r.init_time << ", \"rounds\": [";
+        for (size_t j = 0; j < r.rounds.size(); j++) {
+            const auto& rr = r.rounds[j];
+            out << (j ? ", " : "") << "[" << rr.frontier << ", " << rr.removed << ", " << rr.edges << ", " << rr.time << "]";
+        }
+        out << "], \"metrics\": {";
+        for (size_t j = 0; j < r.metrics.size(); j++)
+            out << (j ? ", " : "") << quote(r.metrics[j].first) << ": " << r.metrics[j].second;
+        out << "}}";
+    }
+    out << "],\n \"round_fields\": [\"frontier\", \"removed\", \"edges\", \"time\"]}\n";
+    return out.str();
+}
+
+// Rewrites path with every repetition recorded so far.
+inline void write(const std::string& path, const meta& m) {
+    std::ofstream out(path);
+    out << to_json(m);
+}
+
+}  // namespace telemetry
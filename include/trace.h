@@ -0,0 +1,177 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gbbs/gbbs.h"
+
+// Per-worker timeline of the MIS phases, exported in the Chrome trace_event
+// JSON format (open in Perfetto or chrome://tracing).
+//
+//   trace::phase p("neighbor_map", round);   // begin of a phase (main thread)
+//   neighbor_map(G, roots, trace::wrap(F));  // F's callbacks mark the worker busy
+//   p.end();
+//
+// A phase is drawn once on the "phases" track and once per worker, spanning
+// that worker's first to last callback inside the phase, so a worker stuck on
+// a hub's adjacency list shows up as the one bar that ends late. Events go to
+// a fixed-size ring per worker (the oldest are overwritten), written to the
+// file by flush().
+//
+// Only compiled in with -DMIS_TRACE (bazel build --config=trace). Otherwise
+// phase is an empty struct, wrap() returns its argument and nothing is
+// recorded, so the calls can stay in production binaries.
+namespace trace {
+
+#ifdef MIS_TRACE
+
+constexpr bool kEnabled = true;
+constexpr size_t kRingEvents = size_t(1) << 16;
+
+inline uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct event {
+    const char* name;
+    uint64_t begin, end;
+    uint64_t arg;
+};
+
+struct ring {
+    std::vector<event> buf;
+    size_t total = 0;
+    void push(const event& e) {
+        if (buf.empty()) buf.resize(kRingEvents);
+        buf[total++ % buf.size()] = e;
+    }
+    template <class F>
+    void for_each(F f) const {
+        size_t k = std::min(total, buf.size());
+        for (size_t i = total - k; i < total; i++) f(buf[i % buf.size()]);
+    }
+};
+
+struct alignas(64) worker_state {
+    uint64_t first = 0, last = 0;  // callbacks seen in the current phase
+    ring events;
+};
+
+struct tracer {
+    bool on = false;
+    uint64_t origin = 0;
+    std::vector<worker_state> workers;
+    ring phases;
+};
+
+inline tracer& global() {
+    static tracer t;
+    return t;
+}
+
+// Idempotent, so gbbs repetitions (-rounds N) share one timeline.
+inline void start() {
+    auto& t = global();
+    if (t.on) return;
+    t.on = true;
+    t.origin = now();
+    t.workers = std::vector<worker_state>(parlay::num_workers());
+}
+
+inline void touch() {
+    auto& t = global();
+    if (!t.on) return;
+    auto& w = t.workers[parlay::worker_id()];
+    uint64_t ts = now();
+    if (!w.first) w.first = ts;
+    w.last = ts;
+}
+
+struct phase {
+    const char* name;
+    uint64_t arg, begin;
+    bool open;
+    explicit phase(const char* _name, uint64_t _arg = 0) : name(_name), arg(_arg), begin(0), open(global().on) {
+        if (!open) return;
+        for (auto& w : global().workers) w.first = w.last = 0;
+        begin = now();
+    }
+    void end() {
+        if (!open) return;
+        open = false;
+        auto& t = global();
+        t.phases.push({name, begin, now(), arg});
+        for (auto& w : t.workers)
+            if (w.first) w.events.push({name, w.first, w.last, arg});
+    }
+    ~phase() { end(); }
+};
+
+// Forwards every callback of an edgeMap functor or a plain lambda, marking
+// the calling worker busy.
+template <class F>
+struct traced {
+    F f;
+    template <class... A>
+    inline auto operator()(A&&... a) -> decltype(f(std::forward<A>(a)...)) { touch(); return f(std::forward<A>(a)...); }
+    template <class... A>
+    inline auto updateAtomic(A&&... a) { touch(); return f.updateAtomic(std::forward<A>(a)...); }
+    template <class... A>
+    inline auto update(A&&... a) { touch(); return f.update(std::forward<A>(a)...); }
+    template <class... A>
+    inline auto cond(A&&... a) { return f.cond(std::forward<A>(a)...); }
+};
+
+template <class F>
+inline traced<F> wrap(F f) { return traced<F>{std::move(f)}; }
+
+inline void write_event(std::ofstream& out, bool& first, const event& e, size_t tid, uint64_t origin) {
+    out << (first ? "\n" : ",\n") << "{\"name\": \"" << e.name << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << tid
+        << ", \"ts\": " << (e.begin - origin) / 1000.0 << ", \"dur\": " << (e.end - e.begin) / 1000.0
+        << ", \"args\": {\"round\": " << e.arg << "}}";
+    first = false;
+}
+
+inline void flush(const std::string& path) {
+    auto& t = global();
+    if (!t.on) return;
+    std::ofstream out(path);
+    out.precision(15);
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool first = true;
+    size_t nw = t.workers.size();
+    out << "\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << nw << ", \"args\": {\"name\": \"phases\"}}";
+    first = false;
+    for (size_t w = 0; w < nw; w++)
+        out << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << w
+            << ", \"args\": {\"name\": \"worker " << w << "\"}}";
+    t.phases.for_each([&](const event& e) { write_event(out, first, e, nw, t.origin); });
+    for (size_t w = 0; w < nw; w++)
+        t.workers[w].events.for_each([&](const event& e) { write_event(out, first, e, w, t.origin); });
+    out << "\n]}\n";
+}
+
+#else
+
+constexpr bool kEnabled = false;
+
+inline void start() {}
+inline void touch() {}
+
+struct phase {
+    explicit phase(const char*, uint64_t = 0) {}
+    void end() {}
+};
+
+template <class F>
+inline F wrap(F f) { return f; }
+
+inline void flush(const std::string&) {}
+
+#endif
+
+}  // namespace trace
@@ -0,0 +1,47 @@
+import os
+import sys
+import csv
+
+# 非 MIS 应用 (MM / Coloring / KCore) 共用的运行脚本，做的事和 MIS/run.py 一样:
+# 并行版本在进程内重复 RUN_REPEAT 次 (外加 1 次预热)，统计写到 <App>/<algo>/telemetry/<graph>.json，
+# benchmark.csv 的每一行由这个 JSON 记录汇总 (去掉预热后的中位数等，见 MIS/run.py 的 summary_row)；
+# 串行版本 (<NN>_sequential) 用 make 编译，记录程序最后一行输出的平均运行时间和读图时间
+# 用法: python3 utils/run_app.py <App> <algo> <record>   (可以在任何目录下运行)
+#   例如: python3 ../utils/run_app.py KCore 05_deterministic 0
+# 图的路径和列表和 MIS 共用 (MIS/config.py)
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+sys.path.insert(0, os.path.join(ROOT, "MIS"))
+from config import GRAPH_PATH, graphs
+from run import execute, execute_seq, execute_live, load_telemetry, summary_row
+
+if __name__ == "__main__":
+    app = str(sys.argv[1])
+    algo = str(sys.argv[2])
+    record = str(sys.argv[3])
+    repeat = int(os.environ.get("RUN_REPEAT", "5"))
+    algo_dir = os.path.join(ROOT, app, algo)
+    execute_live(["mkdir", "-p", "output", "telemetry"], algo_dir)
+    if algo.split("_", 1)[1].startswith("sequential"):
+        execute_live(["make"], algo_dir)
+        with open(os.path.join(algo_dir, "benchmark.csv"), 'w', newline='', encoding='utf-8') as f:
+            writer = csv.writer(f)
+            writer.writerow(["graph name", "Running Time", "Load Time"])
+            for graph in graphs:
+                row = [graph] + execute_seq(["./" + app, GRAPH_PATH + graph + ".bin", record], algo_dir)
+                print(row)
+                writer.writerow(row)
+    else:
+        execute_live(["bazel", "build", "//" + app + "/" + algo + ":" + app + "_main", "-c", "opt"], ROOT)
+        with open(os.path.join(algo_dir, "benchmark.csv"), 'w', newline='', encoding='utf-8') as f:
+            writer = csv.writer(f)
+            writer.writerow(["graph name", "Running Time", "Running Time (min)", "Running Time (ci95)",
+                             "Counter Initialization Time", "rounds", "edges traversed", "repetitions"])
+            for graph in graphs:
+                json_path = app + "/" + algo + "/telemetry/" + graph + ".json"
+                flags = ["-verify"] if record != "0" else []
+                execute(["bazel-bin/" + app + "/" + algo + "/" + app + "_main", "-s", "-b", "-rounds", str(repeat + 1),
+                         "-json", json_path] + flags + [GRAPH_PATH + graph + ".bin"], ROOT)
+                row = [graph] + summary_row(load_telemetry(os.path.join(ROOT, json_path)))
+                print(row)
+                writer.writerow(row)